@@ -45,4 +45,8 @@ SOFTWARE.
   #endif
 #endif
 
+#if !defined(ETL_HAS_ATOMIC_WAIT)
+  #define ETL_HAS_ATOMIC_WAIT 0
+#endif
+
 #endif
@@ -36,6 +36,11 @@ SOFTWARE.
 #include <atomic>
 #include <stdint.h>
 
+// Can a thread block until an atomic changes?
+#if defined(__cpp_lib_atomic_wait) && !defined(ETL_NO_ATOMIC_WAIT)
+  #define ETL_HAS_ATOMIC_WAIT 1
+#endif
+
 namespace etl
 {
   //***************************************************************************
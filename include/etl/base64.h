@@ -33,6 +33,21 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "type_traits.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+/// SSSE3 support for encoding and decoding blocks.
+/// Define ETL_NO_BASE64_SIMD to use the portable SWAR code.
+//*****************************************************************************
+#if ETL_USING_SSSE3 && !defined(ETL_NO_BASE64_SIMD)
+  #define ETL_USING_BASE64_SSSE3 1
+  #include <tmmintrin.h>
+  #include <string.h>
+#else
+  #define ETL_USING_BASE64_SSSE3 0
+#endif
+
 /**************************************************************************************************************************************************************************
  * See https://en.wikipedia.org/wiki/Base64
  *
@@ -202,6 +217,259 @@ namespace etl
       return "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+,";
     }
 
+    //*************************************************************************
+    // Encodes whole groups of three octets to four characters each.
+    // Sixteen characters are produced at a time with SSSE3.
+    //*************************************************************************
+    template <typename T>
+    static ETL_CONSTEXPR14 void encode_groups(const T* input, size_t groups, char* output, const char* encoder_table_)
+    {
+#if ETL_USING_BASE64_SSSE3
+      if (!etl::is_constant_evaluated())
+      {
+        // Each block reads 16 octets and uses 12.
+        while (groups >= 6U)
+        {
+          encode_block_ssse3(input, output, encoder_table_[62], encoder_table_[63]);
+          input  += 12U;
+          output += 16U;
+          groups -= 4U;
+        }
+      }
+#endif
+
+      while (groups != 0U)
+      {
+        const uint32_t octets = (static_cast<uint32_t>(static_cast<uint8_t>(input[0])) << 16U) |
+                                (static_cast<uint32_t>(static_cast<uint8_t>(input[1])) << 8U) |
+                                 static_cast<uint32_t>(static_cast<uint8_t>(input[2]));
+
+        output[0] = encoder_table_[(octets >> 18U) & 0x3FU];
+        output[1] = encoder_table_[(octets >> 12U) & 0x3FU];
+        output[2] = encoder_table_[(octets >> 6U) & 0x3FU];
+        output[3] = encoder_table_[octets & 0x3FU];
+
+        input  += 3U;
+        output += 4U;
+        --groups;
+      }
+    }
+
+    //*************************************************************************
+    // Decodes whole groups of four characters to three octets each.
+    // Eight characters are decoded at a time using SWAR, or sixteen with SSSE3.
+    // SWAR needs 64 bit types. Without them, only SSSE3 is used, and the
+    // remaining groups are left to the caller's character at a time decoder.
+    // Stops before any block containing padding or an invalid character.
+    // Returns the number of groups decoded.
+    //*************************************************************************
+    template <typename T>
+    static ETL_CONSTEXPR14 size_t decode_groups(const T* input, size_t groups, unsigned char* output, const char* encoder_table_)
+    {
+      const size_t total_groups = groups;
+
+#if ETL_USING_BASE64_SSSE3
+      if (!etl::is_constant_evaluated())
+      {
+        while ((groups >= 4U) && decode_block_ssse3(input, output, encoder_table_[62], encoder_table_[63]))
+        {
+          input  += 16U;
+          output += 12U;
+          groups -= 4U;
+        }
+      }
+#endif
+
+#if ETL_USING_64BIT_TYPES
+      while (groups != 0U)
+      {
+        // Decode two groups, or one, padding the word with valid characters.
+        const size_t length = (groups >= 2U) ? 8U : 4U;
+
+        uint64_t characters = 0U;
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          const uint64_t c = (i < length) ? static_cast<uint8_t>(input[i]) : uint8_t('A');
+
+          characters |= c << (8U * i);
+        }
+
+        uint64_t sextets = 0U;
+
+        if (!swar_decode(characters, encoder_table_[62], encoder_table_[63], sextets))
+        {
+          break;
+        }
+
+        uint64_t octets = 0U;
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          octets |= ((sextets >> (8U * i)) & 0x3FU) << (42U - (6U * i));
+        }
+
+        for (size_t i = 0U; i < ((length / 4U) * 3U); ++i)
+        {
+          output[i] = static_cast<unsigned char>(octets >> (40U - (8U * i)));
+        }
+
+        input  += length;
+        output += (length / 4U) * 3U;
+        groups -= length / 4U;
+      }
+#else
+      (void)input;
+      (void)output;
+      (void)encoder_table_;
+#endif
+
+      return total_groups - groups;
+    }
+
+  private:
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    // Adds each byte of 'b' to each byte of 'a', without carries between bytes.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 uint64_t swar_add(uint64_t a, uint64_t b)
+    {
+      const uint64_t high = 0x8080808080808080ULL;
+
+      return ((a & ~high) + (b & ~high)) ^ ((a ^ b) & high);
+    }
+
+    //*************************************************************************
+    // Returns 0xFF for each byte that is greater than or equal to 'k', else 0.
+    // Each byte must be less than 0x80, and 'k' between 1 and 0x80.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 uint64_t swar_greater_equal(uint64_t x, uint64_t k)
+    {
+      const uint64_t ones = 0x0101010101010101ULL;
+
+      return (((x + (ones * (0x80U - k))) >> 7U) & ones) * 0xFFU;
+    }
+
+    //*************************************************************************
+    // Returns the byte that each byte of 'k' is copied to.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 uint64_t swar_broadcast(int k)
+    {
+      return 0x0101010101010101ULL * static_cast<uint8_t>(k);
+    }
+
+    //*************************************************************************
+    // Converts eight characters to sextets.
+    // Returns false if any character is not in the alphabet.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 bool swar_decode(uint64_t characters, char c62, char c63, uint64_t& sextets)
+    {
+      if ((characters & 0x8080808080808080ULL) != 0U)
+      {
+        return false;
+      }
+
+      const uint64_t k62 = static_cast<uint8_t>(c62);
+      const uint64_t k63 = static_cast<uint8_t>(c63);
+
+      const uint64_t upper = swar_greater_equal(characters, 'A') & ~swar_greater_equal(characters, 'Z' + 1);
+      const uint64_t lower = swar_greater_equal(characters, 'a') & ~swar_greater_equal(characters, 'z' + 1);
+      const uint64_t digit = swar_greater_equal(characters, '0') & ~swar_greater_equal(characters, '9' + 1);
+      const uint64_t is62  = swar_greater_equal(characters, k62) & ~swar_greater_equal(characters, k62 + 1U);
+      const uint64_t is63  = swar_greater_equal(characters, k63) & ~swar_greater_equal(characters, k63 + 1U);
+
+      if ((upper | lower | digit | is62 | is63) != ~uint64_t(0U))
+      {
+        return false;
+      }
+
+      const uint64_t offsets = (swar_broadcast(-'A') & upper) |
+                               (swar_broadcast(26 - 'a') & lower) |
+                               (swar_broadcast(52 - '0') & digit) |
+                               (swar_broadcast(62 - c62) & is62) |
+                               (swar_broadcast(63 - c63) & is63);
+
+      sextets = swar_add(characters, offsets);
+
+      return true;
+    }
+#endif
+
+#if ETL_USING_BASE64_SSSE3
+    //*************************************************************************
+    // Encodes 12 of the 16 octets read to 16 characters.
+    //*************************************************************************
+    template <typename T>
+    static void encode_block_ssse3(const T* input, char* output, char c62, char c63)
+    {
+      // Spread each group of three octets over four bytes, then move each sextet to its own byte.
+      __m128i octets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+      octets         = _mm_shuffle_epi8(octets, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+      const __m128i t0      = _mm_mulhi_epu16(_mm_and_si128(octets, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+      const __m128i t1      = _mm_mullo_epi16(_mm_and_si128(octets, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+      const __m128i sextets = _mm_or_si128(t0, t1);
+
+      // Select an offset for each sextet: 0 for 26-51, 1-10 for 52-61, 11 and 12 for 62 and 63, and 13 for 0-25.
+      __m128i selector = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+      selector         = _mm_or_si128(selector, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
+
+      const char o09 = static_cast<char>('0' - 52);
+
+      const __m128i offsets = _mm_setr_epi8(static_cast<char>('a' - 26), o09, o09, o09, o09, o09, o09, o09, o09, o09, o09,
+                                            static_cast<char>(c62 - 62), static_cast<char>(c63 - 63), 'A', 0, 0);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_add_epi8(_mm_shuffle_epi8(offsets, selector), sextets));
+    }
+
+    //*************************************************************************
+    // Decodes 16 characters to 12 octets.
+    // Returns false if any character is not in the alphabet.
+    //*************************************************************************
+    template <typename T>
+    static bool decode_block_ssse3(const T* input, unsigned char* output, char c62, char c63)
+    {
+      const __m128i characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+
+      // Characters above 0x7F are negative, so are in none of the ranges.
+      const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), characters));
+      const __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), characters));
+      const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), characters));
+      const __m128i is62  = _mm_cmpeq_epi8(characters, _mm_set1_epi8(c62));
+      const __m128i is63  = _mm_cmpeq_epi8(characters, _mm_set1_epi8(c63));
+
+      const __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, is62)), is63);
+
+      if (_mm_movemask_epi8(valid) != 0xFFFF)
+      {
+        return false;
+      }
+
+      __m128i offsets = _mm_and_si128(upper, _mm_set1_epi8(static_cast<char>(-'A')));
+      offsets         = _mm_or_si128(offsets, _mm_and_si128(lower, _mm_set1_epi8(static_cast<char>(26 - 'a'))));
+      offsets         = _mm_or_si128(offsets, _mm_and_si128(digit, _mm_set1_epi8(static_cast<char>(52 - '0'))));
+      offsets         = _mm_or_si128(offsets, _mm_and_si128(is62, _mm_set1_epi8(static_cast<char>(62 - c62))));
+      offsets         = _mm_or_si128(offsets, _mm_and_si128(is63, _mm_set1_epi8(static_cast<char>(63 - c63))));
+
+      const __m128i sextets = _mm_add_epi8(characters, offsets);
+
+      // Merge pairs of sextets, then pairs of pairs, then put the octets in order.
+      __m128i octets = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+      octets         = _mm_madd_epi16(octets, _mm_set1_epi32(0x00011000));
+      octets         = _mm_shuffle_epi8(octets, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(output), octets);
+
+      const int32_t last = _mm_cvtsi128_si32(_mm_srli_si128(octets, 8));
+      memcpy(output + 8U, &last, 4U);
+
+      return true;
+    }
+#endif
+
+  protected:
+
     const char* encoder_table;
     const bool  use_padding;
   };
@@ -105,15 +105,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_begin != input_end)
-      {
-        if (!decode(*input_begin++))
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return decode_range(input_begin, input_end, etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value>());
     }
 
     //*************************************************************************
@@ -124,15 +116,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_length-- != 0)
-      {
-        if (!decode(*input_begin++))
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return decode_range(input_begin, input_length, etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value>());
     }
 
     //*************************************************************************
@@ -314,6 +298,100 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    // Decodes a range, one character at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 bool decode_range(TInputIterator input_begin, size_t input_length, etl::false_type)
+    {
+      while (input_length-- != 0)
+      {
+        if (!decode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Decodes a range, one character at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 bool decode_range(TInputIterator input_begin, TInputIterator input_end, etl::false_type)
+    {
+      while (input_begin != input_end)
+      {
+        if (!decode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Decodes a range of pointers.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 bool decode_range(TInputIterator input_begin, TInputIterator input_end, etl::true_type)
+    {
+      return decode_range(input_begin, static_cast<size_t>(input_end - input_begin), etl::true_type());
+    }
+
+    //*************************************************************************
+    // Decodes a range of pointers.
+    // Whole groups of four characters are decoded in blocks, directly to the
+    // output buffer, up to any padding or invalid character.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 bool decode_range(TInputIterator input_begin, size_t input_length, etl::true_type)
+    {
+      // Complete any partial group.
+      while ((input_length != 0U) && (input_buffer_length != 0U))
+      {
+        --input_length;
+
+        if (!decode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      while (!error() && !padding_received && (input_length >= 4U))
+      {
+        const size_t groups = etl::min(input_length / 4U, (output_buffer_max_size - output_buffer_length) / 3U);
+
+        // Leave a full buffer to the character at a time decoder, to report the overflow.
+        if (groups == 0U)
+        {
+          break;
+        }
+
+        const size_t decoded = decode_groups(input_begin, groups, p_output_buffer + output_buffer_length, encoder_table);
+
+        input_begin += (decoded * 4U);
+        input_length -= (decoded * 4U);
+        output_buffer_length += (decoded * 3U);
+
+        if (callback.is_valid() && output_buffer_is_full())
+        {
+          callback(span());
+          reset_output_buffer();
+        }
+
+        // Leave padding and invalid characters to the character at a time decoder.
+        if (decoded != groups)
+        {
+          break;
+        }
+      }
+
+      return decode_range(input_begin, input_length, etl::false_type());
+    }
+
     //*************************************************************************
     // Translates a sextet into an index
     //*************************************************************************
@@ -103,15 +103,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_length-- != 0)
-      {
-        if (!encode(*input_begin++))
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return encode_range(input_begin, input_length, etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value>());
     }
 
     //*************************************************************************
@@ -122,15 +114,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
-      while (input_begin != input_end)
-      {
-        if (!encode(*input_begin++))
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return encode_range(input_begin, input_end, etl::integral_constant<bool, etl::is_pointer<TInputIterator>::value>());
     }
 
     //*************************************************************************
@@ -393,6 +377,94 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    // Encodes a range, one octet at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 bool encode_range(TInputIterator input_begin, size_t input_length, etl::false_type)
+    {
+      while (input_length-- != 0)
+      {
+        if (!encode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Encodes a range, one octet at a time.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 bool encode_range(TInputIterator input_begin, TInputIterator input_end, etl::false_type)
+    {
+      while (input_begin != input_end)
+      {
+        if (!encode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    // Encodes a range of pointers.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 bool encode_range(TInputIterator input_begin, TInputIterator input_end, etl::true_type)
+    {
+      return encode_range(input_begin, static_cast<size_t>(input_end - input_begin), etl::true_type());
+    }
+
+    //*************************************************************************
+    // Encodes a range of pointers.
+    // Whole groups of three octets are encoded in blocks, directly to the
+    // output buffer.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14 bool encode_range(TInputIterator input_begin, size_t input_length, etl::true_type)
+    {
+      // Complete any partial group.
+      while ((input_length != 0U) && (input_buffer_length != 0U))
+      {
+        --input_length;
+
+        if (!encode(*input_begin++))
+        {
+          return false;
+        }
+      }
+
+      while (!error() && (input_length >= 3U))
+      {
+        const size_t groups = etl::min(input_length / 3U, (output_buffer_max_size - output_buffer_length) / 4U);
+
+        // Leave a full buffer to the octet at a time encoder, to report the overflow.
+        if (groups == 0U)
+        {
+          break;
+        }
+
+        encode_groups(input_begin, groups, p_output_buffer + output_buffer_length, encoder_table);
+
+        input_begin += (groups * 3U);
+        input_length -= (groups * 3U);
+        output_buffer_length += (groups * 4U);
+
+        if (callback.is_valid() && output_buffer_is_full())
+        {
+          callback(span());
+          reset_output_buffer();
+        }
+      }
+
+      return encode_range(input_begin, input_length, etl::false_type());
+    }
+
     //*************************************************************************
     // Push to the output buffer.
     //*************************************************************************
@@ -50,6 +50,8 @@ SOFTWARE.
 #include "span.h"
 #include "utility.h"
 
+#include "private/atomic_wait.h"
+
 #include <stddef.h>
 
 #if ETL_HAS_ATOMIC
@@ -188,6 +190,10 @@ namespace etl
       , write(0)
       , last(0)
       , Reserved(reserved_)
+  #if ETL_HAS_ATOMIC_WAIT
+      , read_waiting(false)
+      , write_waiting(false)
+  #endif
     {
     }
 
@@ -197,8 +203,87 @@ namespace etl
       read.store(0, etl::memory_order_release);
       write.store(0, etl::memory_order_release);
       last.store(0, etl::memory_order_release);
+
+      notify_read();
+      notify_write();
+    }
+
+    //*************************************************************************
+    size_type get_read_index() const
+    {
+      return read.load(etl::memory_order_acquire);
     }
 
+    //*************************************************************************
+    size_type get_write_index() const
+    {
+      return write.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    // Waits while the reader has not moved from 'read_index'.
+    //*************************************************************************
+    void wait_while_read_index(size_type read_index) const
+    {
+  #if ETL_HAS_ATOMIC_WAIT
+      etl::private_atomic_wait::wait_while_equal(read, read_index, read_waiting);
+  #else
+      etl::private_atomic_wait::wait_while_equal(read, read_index);
+  #endif
+    }
+
+    //*************************************************************************
+    // Waits while the writer has not moved from 'write_index'.
+    //*************************************************************************
+    void wait_while_write_index(size_type write_index) const
+    {
+  #if ETL_HAS_ATOMIC_WAIT
+      etl::private_atomic_wait::wait_while_equal(write, write_index, write_waiting);
+  #else
+      etl::private_atomic_wait::wait_while_equal(write, write_index);
+  #endif
+    }
+
+    //*************************************************************************
+    // Wakes a writer waiting for the reader to move, if there is one.
+    //*************************************************************************
+    void notify_read()
+    {
+  #if ETL_HAS_ATOMIC_WAIT
+      etl::private_atomic_wait::notify(read, read_waiting);
+  #endif
+    }
+
+    //*************************************************************************
+    // Wakes a reader waiting for the writer to move, if there is one.
+    //*************************************************************************
+    void notify_write()
+    {
+  #if ETL_HAS_ATOMIC_WAIT
+      etl::private_atomic_wait::notify(write, write_waiting);
+  #endif
+    }
+
+  #if ETL_USING_CPP11
+    //*************************************************************************
+    // Waits while the reader has not moved from 'read_index', until 'deadline'.
+    //*************************************************************************
+    template <typename TClock, typename TDuration>
+    bool wait_while_read_index_until(size_type read_index, const etl::chrono::time_point<TClock, TDuration>& deadline) const
+    {
+      return etl::private_atomic_wait::wait_while_equal_until(read, read_index, deadline);
+    }
+
+    //*************************************************************************
+    // Waits while the writer has not moved from 'write_index', until 'deadline'.
+    //*************************************************************************
+    template <typename TClock, typename TDuration>
+    bool wait_while_write_index_until(size_type write_index, const etl::chrono::time_point<TClock, TDuration>& deadline) const
+    {
+      return etl::private_atomic_wait::wait_while_equal_until(write, write_index, deadline);
+    }
+  #endif
+
     //*************************************************************************
     size_type get_write_reserve(size_type* psize, size_type fallback_size = numeric_limits<size_type>::max())
     {
@@ -287,6 +372,7 @@ namespace etl
 
         // Always update write index
         write.store(windex + wsize, etl::memory_order_release);
+        notify_write();
       }
     }
 
@@ -335,6 +421,7 @@ namespace etl
         ETL_ASSERT_OR_RETURN((rindex == get_read_reserve(&rsize_checker)) && (rsize == rsize_checker), ETL_ERROR(bip_buffer_reserve_invalid));
 
         read.store(rindex + rsize, etl::memory_order_release);
+        notify_read();
       }
     }
 
@@ -344,6 +431,10 @@ namespace etl
     etl::atomic<size_type> write;
     etl::atomic<size_type> last;
     const size_type        Reserved;
+  #if ETL_HAS_ATOMIC_WAIT
+    mutable etl::atomic<bool> read_waiting;  ///< Set while the writer is blocked on 'read'.
+    mutable etl::atomic<bool> write_waiting; ///< Set while the reader is blocked on 'write'.
+  #endif
 
   #if defined(ETL_POLYMORPHIC_SPSC_BIP_BUFFER_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
 
@@ -370,8 +461,16 @@ namespace etl
     using base_t::apply_read_reserve;
     using base_t::apply_write_reserve;
     using base_t::get_read_reserve;
+    using base_t::get_read_index;
+    using base_t::get_write_index;
     using base_t::get_write_reserve;
     using base_t::reset;
+    using base_t::wait_while_read_index;
+    using base_t::wait_while_write_index;
+  #if ETL_USING_CPP11
+    using base_t::wait_while_read_index_until;
+    using base_t::wait_while_write_index_until;
+  #endif
 
   public:
 
@@ -441,6 +540,114 @@ namespace etl
       apply_write_reserve(windex, reserve.size());
     }
 
+    //*************************************************************************
+    // Reserves a memory area for reading (up to the max_reserve_size), waiting
+    // until there is something to read.
+    // Spins, then blocks until the writer commits.
+    //*************************************************************************
+    span<T> read_reserve_wait(size_type max_reserve_size = numeric_limits<size_type>::max())
+    {
+      for (;;)
+      {
+        size_type write_index = get_write_index();
+        span<T>   reserve     = read_reserve(max_reserve_size);
+
+        if (!reserve.empty() || (max_reserve_size == 0U))
+        {
+          return reserve;
+        }
+
+        wait_while_write_index(write_index);
+      }
+    }
+
+    //*************************************************************************
+    // Reserves a memory area for writing up to the max_reserve_size, waiting
+    // until there is space.
+    // Spins, then blocks until the reader commits.
+    //*************************************************************************
+    span<T> write_reserve_wait(size_type max_reserve_size)
+    {
+      for (;;)
+      {
+        size_type read_index = get_read_index();
+        span<T>   reserve    = write_reserve(max_reserve_size);
+
+        if (!reserve.empty() || (max_reserve_size == 0U))
+        {
+          return reserve;
+        }
+
+        wait_while_read_index(read_index);
+      }
+    }
+
+  #if ETL_USING_CPP11
+    //*************************************************************************
+    // Reserves a memory area for reading (up to the max_reserve_size), waiting
+    // until there is something to read or 'deadline' has passed.
+    // Returns an empty span if the deadline passed.
+    //*************************************************************************
+    template <typename TClock, typename TDuration>
+    span<T> read_reserve_wait_until(size_type max_reserve_size, const etl::chrono::time_point<TClock, TDuration>& deadline)
+    {
+      for (;;)
+      {
+        size_type write_index = get_write_index();
+        span<T>   reserve     = read_reserve(max_reserve_size);
+
+        if (!reserve.empty() || (max_reserve_size == 0U) || !wait_while_write_index_until(write_index, deadline))
+        {
+          return reserve;
+        }
+      }
+    }
+
+    //*************************************************************************
+    // Reserves a memory area for reading (up to the max_reserve_size), waiting
+    // until there is something to read or 'timeout' has elapsed on
+    // etl::chrono::steady_clock.
+    // Returns an empty span if the timeout elapsed.
+    //*************************************************************************
+    template <typename TRep, typename TPeriod>
+    span<T> read_reserve_wait_for(size_type max_reserve_size, const etl::chrono::duration<TRep, TPeriod>& timeout)
+    {
+      return read_reserve_wait_until(max_reserve_size, etl::chrono::steady_clock::now() + timeout);
+    }
+
+    //*************************************************************************
+    // Reserves a memory area for writing up to the max_reserve_size, waiting
+    // until there is space or 'deadline' has passed.
+    // Returns an empty span if the deadline passed.
+    //*************************************************************************
+    template <typename TClock, typename TDuration>
+    span<T> write_reserve_wait_until(size_type max_reserve_size, const etl::chrono::time_point<TClock, TDuration>& deadline)
+    {
+      for (;;)
+      {
+        size_type read_index = get_read_index();
+        span<T>   reserve    = write_reserve(max_reserve_size);
+
+        if (!reserve.empty() || (max_reserve_size == 0U) || !wait_while_read_index_until(read_index, deadline))
+        {
+          return reserve;
+        }
+      }
+    }
+
+    //*************************************************************************
+    // Reserves a memory area for writing up to the max_reserve_size, waiting
+    // until there is space or 'timeout' has elapsed on
+    // etl::chrono::steady_clock.
+    // Returns an empty span if the timeout elapsed.
+    //*************************************************************************
+    template <typename TRep, typename TPeriod>
+    span<T> write_reserve_wait_for(size_type max_reserve_size, const etl::chrono::duration<TRep, TPeriod>& timeout)
+    {
+      return write_reserve_wait_until(max_reserve_size, etl::chrono::steady_clock::now() + timeout);
+    }
+  #endif
+
     //*************************************************************************
     /// Clears the buffer, destructing any elements that haven't been read.
     //*************************************************************************
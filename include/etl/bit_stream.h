@@ -44,9 +44,20 @@ SOFTWARE.
 
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "private/minmax_push.h"
 
+//*****************************************************************************
+// bit_stream_writer and bit_stream_reader move fields through a 64 bit word if
+// chars are 8 bits and 64 bit types are available. Otherwise a char at a time.
+//*****************************************************************************
+#if (CHAR_BIT == 8) && ETL_USING_64BIT_TYPES
+  #define ETL_BIT_STREAM_USING_WORD_ACCESS 1
+#else
+  #define ETL_BIT_STREAM_USING_WORD_ACCESS 0
+#endif
+
 namespace etl
 {
   //***************************************************************************
@@ -931,6 +942,9 @@ namespace etl
       }
 
       // Send the bits to the stream.
+#if ETL_BIT_STREAM_USING_WORD_ACCESS
+      write_bits(static_cast<uint64_t>(value), nbits);
+#else
       while (nbits != 0)
       {
         unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
@@ -944,6 +958,7 @@ namespace etl
 
         write_chunk(static_cast<char>(chunk), mask_width);
       }
+#endif
 
       if (callback.is_valid())
       {
@@ -951,6 +966,73 @@ namespace etl
       }
     }
 
+#if ETL_BIT_STREAM_USING_WORD_ACCESS
+    //***************************************************************************
+    /// Write up to 64 bits to the stream.
+    /// The bits are shifted into place in a 64 bit word, after those already
+    /// used in the current char, then merged with the stream in one unaligned
+    /// store.
+    //***************************************************************************
+    void write_bits(uint64_t value, uint_least8_t nbits)
+    {
+      if (nbits == 0U)
+      {
+        return;
+      }
+
+      // The number of bits already used in the current char.
+      const size_t offset = CHAR_BIT - bits_available_in_char;
+
+      // Split the value if it does not fit in the word.
+      if ((offset + nbits) > 64U)
+      {
+        write_bits(value >> 32U, static_cast<uint_least8_t>(nbits - 32U));
+        write_bits(value, 32U);
+        return;
+      }
+
+      uint64_t     word  = (value << (64U - nbits)) >> offset;
+      const size_t total = offset + nbits;
+      const size_t chars = (total + (CHAR_BIT - 1U)) / CHAR_BIT;
+
+      const size_t remaining = (char_index < length_chars) ? (length_chars - char_index) : 0U;
+
+      if (remaining >= 8U)
+      {
+        // Keep a partially filled first char, and the chars after those written.
+        uint64_t keep = (offset == 0U) ? 0U : 0xFF00000000000000ULL;
+
+        if (chars < 8U)
+        {
+          keep |= (~uint64_t(0U) >> (CHAR_BIT * chars));
+        }
+
+        uint64_t stream_word;
+        memcpy(&stream_word, pdata + char_index, sizeof(stream_word));
+
+        word |= etl::ntoh(stream_word) & keep;
+        word  = etl::hton(word);
+
+        memcpy(pdata + char_index, &word, sizeof(word));
+      }
+      else
+      {
+        // Near the end of the stream, store a char at a time.
+        // Merge with a partially filled char, or clear a new one.
+        const char first  = (offset == 0U) ? char(0) : pdata[char_index];
+        pdata[char_index] = static_cast<char>(first | static_cast<char>(word >> 56U));
+
+        for (size_t i = 1U; i < chars; ++i)
+        {
+          pdata[char_index + i] = static_cast<char>(word >> (56U - (CHAR_BIT * i)));
+        }
+      }
+
+      char_index += total / CHAR_BIT;
+      bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - (total % CHAR_BIT));
+      bits_available -= nbits;
+    }
+#else
     //***************************************************************************
     /// Write a data chunk to the stream
     //***************************************************************************
@@ -965,6 +1047,7 @@ namespace etl
       pdata[char_index] |= chunk;
       step(nbits);
     }
+#endif
 
     //***************************************************************************
     /// Flush full bytes to the callback, if valid.
@@ -1307,10 +1390,14 @@ namespace etl
     {
       ETL_ASSERT(nbits <= (CHAR_BIT * sizeof(T)), ETL_ERROR_GENERIC("bit_stream_reader::read_value: nbits too large"));
 
-      T             value = 0;
-      uint_least8_t bits  = nbits;
+      const uint_least8_t bits = nbits;
 
       // Get the bits from the stream.
+#if ETL_BIT_STREAM_USING_WORD_ACCESS
+      T value = static_cast<T>(read_bits(nbits));
+#else
+      T value = 0;
+
       while (nbits != 0)
       {
         unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
@@ -1320,6 +1407,7 @@ namespace etl
         nbits -= mask_width;
         value |= static_cast<T>(chunk << nbits);
       }
+#endif
 
       if (bit_order == etl::bit_order::lsb_first)
       {
@@ -1342,6 +1430,57 @@ namespace etl
       return value;
     }
 
+#if ETL_BIT_STREAM_USING_WORD_ACCESS
+    //***************************************************************************
+    /// Read up to 64 bits from the stream.
+    /// The next eight chars are loaded into a 64 bit word with one unaligned
+    /// load, from which the bits are extracted with shifts.
+    //***************************************************************************
+    uint64_t read_bits(uint_least8_t nbits)
+    {
+      if (nbits == 0U)
+      {
+        return 0U;
+      }
+
+      // The number of bits already used in the current char.
+      const size_t offset = CHAR_BIT - bits_available_in_char;
+
+      // Split the value if it does not fit in the word.
+      if ((offset + nbits) > 64U)
+      {
+        const uint64_t high = read_bits(static_cast<uint_least8_t>(nbits - 32U));
+
+        return (high << 32U) | read_bits(32U);
+      }
+
+      uint64_t word = 0U;
+
+      const size_t remaining = (char_index < length_chars) ? (length_chars - char_index) : 0U;
+
+      if (remaining >= 8U)
+      {
+        memcpy(&word, pdata + char_index, sizeof(word));
+        word = etl::ntoh(word);
+      }
+      else
+      {
+        // Near the end of the stream, load what is left.
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          word = (word << CHAR_BIT) | ((i < remaining) ? static_cast<unsigned char>(pdata[char_index + i]) : 0U);
+        }
+      }
+
+      const size_t total = offset + nbits;
+
+      char_index += total / CHAR_BIT;
+      bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - (total % CHAR_BIT));
+      bits_available -= nbits;
+
+      return (word << offset) >> (64U - nbits);
+    }
+#else
     //***************************************************************************
     /// Get a data chunk from the stream
     //***************************************************************************
@@ -1367,6 +1506,7 @@ namespace etl
 
       return value;
     }
+#endif
 
     //***************************************************************************
     /// Get a bool from the stream
@@ -1457,6 +1597,8 @@ namespace etl
   }
 } // namespace etl
 
+#undef ETL_BIT_STREAM_USING_WORD_ACCESS
+
 #include "private/minmax_pop.h"
 
 #endif
@@ -0,0 +1,810 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BROADCAST_BUFFER_SPMC_ATOMIC_INCLUDED
+#define ETL_BROADCAST_BUFFER_SPMC_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "integral_limits.h"
+#include "memory_model.h"
+#include "placement_new.h"
+#include "span.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/ring_index.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for a broadcast_buffer_spmc_atomic.
+  //***************************************************************************
+  class broadcast_buffer_spmc_atomic_exception : public etl::exception
+  {
+  public:
+
+    broadcast_buffer_spmc_atomic_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for a consumer index that is out of range.
+  //***************************************************************************
+  class broadcast_buffer_spmc_atomic_invalid_consumer : public etl::broadcast_buffer_spmc_atomic_exception
+  {
+  public:
+
+    broadcast_buffer_spmc_atomic_invalid_consumer(string_type file_name_, numeric_type line_number_)
+      : broadcast_buffer_spmc_atomic_exception(ETL_ERROR_TEXT("broadcast_buffer_spmc_atomic:consumer", ETL_BROADCAST_BUFFER_SPMC_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for releasing more items than are available.
+  //***************************************************************************
+  class broadcast_buffer_spmc_atomic_release_invalid : public etl::broadcast_buffer_spmc_atomic_exception
+  {
+  public:
+
+    broadcast_buffer_spmc_atomic_release_invalid(string_type file_name_, numeric_type line_number_)
+      : broadcast_buffer_spmc_atomic_exception(ETL_ERROR_TEXT("broadcast_buffer_spmc_atomic:release", ETL_BROADCAST_BUFFER_SPMC_ATOMIC_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup broadcast_buffer_spmc_atomic
+  /// The base for all broadcast buffers.
+  /// Holds the producer's write index and one read cursor per consumer.
+  //***************************************************************************
+  template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class broadcast_buffer_spmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of the buffer.
+    typedef typename etl::size_type_lookup<Memory_Model>::type size_type;
+
+    //*************************************************************************
+    /// The read position of one consumer.
+    //*************************************************************************
+    struct cursor_type
+    {
+      etl::atomic<size_type> read;          ///< Where the consumer gets its oldest data.
+      size_type              write_cache;   ///< The consumer's copy of 'write'.
+      size_type              read_acquired; ///< The value of 'read' when the consumer last acquired a region.
+  #if defined(ETL_BROADCAST_BUFFER_SPMC_ATOMIC_CACHE_LINE_ISOLATION)
+      char                   padding[ETL_CACHE_LINE_SIZE];
+  #endif
+    };
+
+    //*************************************************************************
+    /// Is the buffer empty for this consumer?
+    /// Accurate from the consumer's thread.
+    //*************************************************************************
+    bool empty(size_t consumer) const
+    {
+      const cursor_type& cursor = get_cursor(consumer);
+
+      return cursor.read.load(etl::memory_order_acquire) == write.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// How many items are waiting for this consumer?
+    /// Accurate from the consumer's thread.
+    //*************************************************************************
+    size_type size(size_t consumer) const
+    {
+      const cursor_type& cursor = get_cursor(consumer);
+
+      size_type read_index  = cursor.read.load(etl::memory_order_acquire);
+      size_type write_index = write.load(etl::memory_order_acquire);
+
+      return etl::private_ring_index::count_used(read_index, write_index, Reserved);
+    }
+
+    //*************************************************************************
+    /// Is the buffer full?
+    /// Full when the slowest consumer has not read any of the buffer.
+    /// Accurate from the producer's thread.
+    //*************************************************************************
+    bool full() const
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      return find_slowest(write_index) == etl::private_ring_index::next(write_index, Reserved);
+    }
+
+    //*************************************************************************
+    /// How much free space is available to the producer?
+    /// Limited by the slowest consumer.
+    /// Accurate from the producer's thread.
+    //*************************************************************************
+    size_type available() const
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      return etl::private_ring_index::count_free(write_index, find_slowest(write_index), Reserved);
+    }
+
+    //*************************************************************************
+    /// How many items can the buffer hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return Reserved - 1;
+    }
+
+    //*************************************************************************
+    /// How many items can the buffer hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Reserved - 1;
+    }
+
+    //*************************************************************************
+    /// How many consumers read from the buffer.
+    //*************************************************************************
+    size_t number_of_consumers() const
+    {
+      return Number_Of_Consumers;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    broadcast_buffer_spmc_atomic_base(cursor_type* p_cursors_, size_t number_of_consumers_, size_type reserved_)
+      : p_cursors(p_cursors_)
+      , Number_Of_Consumers(number_of_consumers_)
+      , Reserved(reserved_)
+      , write(0)
+      , read_cache(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets all of the cursors to the empty state.
+    /// Called from the derived class, after the cursors have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0; i < Number_Of_Consumers; ++i)
+      {
+        p_cursors[i].read.store(0, etl::memory_order_relaxed);
+        p_cursors[i].write_cache   = 0;
+        p_cursors[i].read_acquired = 0;
+      }
+
+      write.store(0, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Gets the cursor for a consumer.
+    //*************************************************************************
+    cursor_type& get_cursor(size_t consumer)
+    {
+      ETL_ASSERT_CHECK_EXTRA(consumer < Number_Of_Consumers, ETL_ERROR(broadcast_buffer_spmc_atomic_invalid_consumer));
+
+      return p_cursors[consumer];
+    }
+
+    //*************************************************************************
+    /// Gets the cursor for a consumer.
+    //*************************************************************************
+    const cursor_type& get_cursor(size_t consumer) const
+    {
+      ETL_ASSERT_CHECK_EXTRA(consumer < Number_Of_Consumers, ETL_ERROR(broadcast_buffer_spmc_atomic_invalid_consumer));
+
+      return p_cursors[consumer];
+    }
+
+    //*************************************************************************
+    /// Finds the read index of the consumer with the most unread items.
+    /// Every other consumer's read index lies between it and 'write_index'.
+    //*************************************************************************
+    size_type find_slowest(size_type write_index) const
+    {
+      size_type slowest = write_index;
+      size_type most    = 0;
+
+      for (size_t i = 0; i < Number_Of_Consumers; ++i)
+      {
+        size_type read_index = p_cursors[i].read.load(etl::memory_order_acquire);
+        size_type n          = etl::private_ring_index::count_used(read_index, write_index, Reserved);
+
+        if (n > most)
+        {
+          most    = n;
+          slowest = read_index;
+        }
+      }
+
+      return slowest;
+    }
+
+    //*************************************************************************
+    /// Can the producer write to the current slot, given the next write index?
+    /// Only checks the consumers' cursors when the cached slowest cursor says
+    /// that the buffer is full.
+    //*************************************************************************
+    bool can_write(size_type write_index, size_type next_index)
+    {
+      if (next_index == read_cache)
+      {
+        read_cache = find_slowest(write_index);
+      }
+
+      return next_index != read_cache;
+    }
+
+    //*************************************************************************
+    /// Moves on any consumer whose cursor has been caught up by the producer,
+    /// dropping that consumer's oldest item.
+    /// Called after 'write' has been set to 'write_index', so that a consumer
+    /// that sees its cursor moved will also see the new write index.
+    //*************************************************************************
+    void drop_overwritten(size_type write_index)
+    {
+      if (write_index == read_cache)
+      {
+        size_type skip_index = etl::private_ring_index::next(write_index, Reserved);
+
+        for (size_t i = 0; i < Number_Of_Consumers; ++i)
+        {
+          size_type read_index = write_index;
+          p_cursors[i].read.compare_exchange_strong(read_index, skip_index, etl::memory_order_acq_rel, etl::memory_order_relaxed);
+        }
+
+        read_cache = find_slowest(write_index);
+      }
+    }
+
+    //*************************************************************************
+    /// How many items can be read by the consumer.
+    /// Only loads 'write' if the cached copy says there are fewer than 'wanted'.
+    //*************************************************************************
+    size_type get_read_available(cursor_type& cursor, size_type read_index, size_type wanted)
+    {
+      size_type n = etl::private_ring_index::count_used(read_index, cursor.write_cache, Reserved);
+
+      if (n < wanted)
+      {
+        cursor.write_cache = write.load(etl::memory_order_acquire);
+        n                  = etl::private_ring_index::count_used(read_index, cursor.write_cache, Reserved);
+      }
+
+      return n;
+    }
+
+    cursor_type* const     p_cursors;           ///< The consumers' cursors.
+    const size_t           Number_Of_Consumers; ///< The number of consumers.
+    const size_type        Reserved;            ///< The number of slots in the buffer.
+  #if defined(ETL_BROADCAST_BUFFER_SPMC_ATOMIC_CACHE_LINE_ISOLATION)
+    char                   padding_reserved[ETL_CACHE_LINE_SIZE];
+  #endif
+    etl::atomic<size_type> write;      ///< Where to input new data.
+    size_type              read_cache; ///< The producer's copy of the slowest consumer's 'read'.
+  #if defined(ETL_BROADCAST_BUFFER_SPMC_ATOMIC_CACHE_LINE_ISOLATION)
+    char                   padding_write[ETL_CACHE_LINE_SIZE];
+  #endif
+
+  private:
+
+      //*************************************************************************
+      /// Destructor.
+      //*************************************************************************
+  #if defined(ETL_POLYMORPHIC_BROADCAST_BUFFER_SPMC_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~broadcast_buffer_spmc_atomic_base() {}
+  #else
+
+  protected:
+
+    ~broadcast_buffer_spmc_atomic_base() {}
+  #endif
+  };
+
+  //***************************************************************************
+  ///\ingroup broadcast_buffer_spmc_atomic
+  ///\brief This is the base for all broadcast buffers that contain a particular type.
+  ///\details A single producer, multiple consumer ring buffer.
+  /// Each item is stored once and is read by every consumer. Each consumer,
+  /// identified by an index in the range [0, number_of_consumers), has its own
+  /// read cursor and must only be used by one thread.
+  /// If 'Overwrite' is false the producer is blocked by the slowest consumer.
+  /// If 'Overwrite' is true the producer never blocks; a consumer that falls a
+  /// whole buffer behind loses its oldest items. A consumer may then read an
+  /// item while it is being overwritten, so 'T' must be trivially copyable, and
+  /// pop() and read_release() check whether the data read is still valid.
+  /// \code
+  /// etl::broadcast_buffer_spmc_atomic<Frame, 16, 3> buffer;
+  /// etl::ibroadcast_buffer_spmc_atomic<Frame>& ibuffer = buffer;
+  /// \endcode
+  /// \tparam T         The type of value that the buffer holds.
+  /// \tparam Overwrite Whether the producer overwrites items that have not been read by all consumers.
+  //***************************************************************************
+  template <typename T, bool Overwrite = false, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class ibroadcast_buffer_spmc_atomic : public broadcast_buffer_spmc_atomic_base<Memory_Model>
+  {
+  private:
+
+    typedef typename etl::broadcast_buffer_spmc_atomic_base<Memory_Model> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(!Overwrite || etl::is_trivially_copyable<T>::value, "Overwrite requires a trivially copyable type");
+
+    typedef T        value_type;      ///< The type stored in the buffer.
+    typedef T&       reference;       ///< A reference to the type used in the buffer.
+    typedef const T& const_reference; ///< A const reference to the type used in the buffer.
+  #if ETL_USING_CPP11
+    typedef T&& rvalue_reference; ///< An rvalue_reference to the type used in the buffer.
+  #endif
+    typedef typename base_t::size_type   size_type;   ///< The type used for determining the size of the buffer.
+    typedef typename base_t::cursor_type cursor_type; ///< The type of a consumer's read position.
+
+    //*************************************************************************
+    /// A read only region of the buffer.
+    /// 'second' is only non-empty when the region wraps around the end of the
+    /// buffer.
+    //*************************************************************************
+    struct region_type
+    {
+      region_type(etl::span<const T> first_, etl::span<const T> second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      /// The total number of items in the region.
+      size_t size() const
+      {
+        return first.size() + second.size();
+      }
+
+      /// Is the region empty?
+      bool empty() const
+      {
+        return size() == 0U;
+      }
+
+      etl::span<const T> first;  ///< The part of the region starting at the current index.
+      etl::span<const T> second; ///< The part of the region that has wrapped to the start of the buffer.
+    };
+
+    using base_t::can_write;
+    using base_t::drop_overwritten;
+    using base_t::get_cursor;
+    using base_t::Reserved;
+    using base_t::write;
+
+    //*************************************************************************
+    /// Push a value to the buffer.
+    /// Must only be called from the producer thread.
+    /// Returns false if the buffer is full. Always succeeds when 'Overwrite' is true.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = etl::private_ring_index::next(write_index, Reserved);
+
+      if (Overwrite || can_write(write_index, next_index))
+      {
+        store(write_index, value);
+
+        write.store(next_index, etl::memory_order_release);
+
+        if (Overwrite)
+        {
+          drop_overwritten(next_index);
+        }
+
+        return true;
+      }
+
+      // Buffer is full.
+      return false;
+    }
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_BROADCAST_BUFFER_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the buffer.
+    /// Must only be called from the producer thread.
+    /// Returns false if the buffer is full. Always succeeds when 'Overwrite' is true.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = etl::private_ring_index::next(write_index, Reserved);
+
+      if (Overwrite || can_write(write_index, next_index))
+      {
+        store(write_index, etl::move(value));
+
+        write.store(next_index, etl::memory_order_release);
+
+        if (Overwrite)
+        {
+          drop_overwritten(next_index);
+        }
+
+        return true;
+      }
+
+      // Buffer is full.
+      return false;
+    }
+  #endif
+
+    //*************************************************************************
+    /// Push values to the buffer.
+    /// Must only be called from the producer thread.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    size_t push(etl::span<const T> values)
+    {
+      size_t n = 0;
+
+      while ((n < values.size()) && push(values[n]))
+      {
+        ++n;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the buffer for a consumer.
+    /// Must only be called from the consumer's thread.
+    /// Returns false if there is nothing to read.
+    //*************************************************************************
+    bool pop(size_t consumer, reference value)
+    {
+      cursor_type& cursor = get_cursor(consumer);
+
+      size_type read_index = load_cursor(cursor);
+
+      while (get_read_available(cursor, read_index, 1U) != 0U)
+      {
+        value = p_buffer[read_index];
+
+        if (advance_cursor(cursor, read_index, 1U))
+        {
+          return true;
+        }
+
+        // Overwritten while being read. 'read_index' has been updated; try again.
+      }
+
+      // Nothing to read.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop values from the buffer for a consumer.
+    /// Must only be called from the consumer's thread.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    size_t pop(size_t consumer, etl::span<T> values)
+    {
+      const size_type max_pop_size = static_cast<size_type>(etl::min(values.size(), size_t(etl::integral_limits<size_type>::max)));
+
+      for (;;)
+      {
+        region_type region = read_acquire(consumer, max_pop_size);
+        size_type   n      = static_cast<size_type>(region.size());
+
+        etl::copy(region.first.begin(), region.first.end(), values.begin());
+        etl::copy(region.second.begin(), region.second.end(), values.begin() + region.first.size());
+
+        if (read_release(consumer, n))
+        {
+          return n;
+        }
+
+        // Overwritten while being read; try again.
+      }
+    }
+
+    //*************************************************************************
+    /// Gets a read only view of up to 'max_acquire_size' items for a consumer.
+    /// Must only be called from the consumer's thread.
+    /// The items remain in the buffer until released by read_release().
+    //*************************************************************************
+    region_type read_acquire(size_t consumer, size_type max_acquire_size = etl::integral_limits<size_type>::max)
+    {
+      cursor_type& cursor = get_cursor(consumer);
+
+      size_type read_index = load_cursor(cursor);
+      size_type n          = etl::min(get_read_available(cursor, read_index, max_acquire_size), max_acquire_size);
+
+      cursor.read_acquired = read_index;
+
+      return make_region(read_index, n);
+    }
+
+    //*************************************************************************
+    /// Releases the first 'n' items of the previously acquired region for a
+    /// consumer.
+    /// Must only be called from the consumer's thread.
+    /// Returns false if 'Overwrite' is true and the producer overwrote the
+    /// region while it was being read, in which case the data is not valid and
+    /// nothing is released.
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::broadcast_buffer_spmc_atomic_release_invalid if 'n' is larger than
+    /// the number of items available.
+    //*************************************************************************
+    bool read_release(size_t consumer, size_type n)
+    {
+      cursor_type& cursor = get_cursor(consumer);
+
+      size_type read_index = load_cursor(cursor);
+
+      // Has the producer moved the cursor since the region was acquired?
+      if (Overwrite && (read_index != cursor.read_acquired))
+      {
+        return false;
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(n <= get_read_available(cursor, read_index, n), ETL_ERROR(broadcast_buffer_spmc_atomic_release_invalid), false);
+
+      return advance_cursor(cursor, read_index, n);
+    }
+
+    //*************************************************************************
+    /// Discards all of the items waiting for a consumer.
+    /// Must only be called from the consumer's thread.
+    //*************************************************************************
+    void clear(size_t consumer)
+    {
+      cursor_type& cursor = get_cursor(consumer);
+
+      size_type read_index = load_cursor(cursor);
+
+      while (!advance_cursor(cursor, read_index, get_read_available(cursor, read_index, Reserved)))
+      {
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ibroadcast_buffer_spmc_atomic(T* p_buffer_, cursor_type* p_cursors_, size_t number_of_consumers_, size_type reserved_)
+      : base_t(p_cursors_, number_of_consumers_, reserved_)
+      , p_buffer(p_buffer_)
+      , constructed(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Destroys the items in the buffer.
+    //*************************************************************************
+    void destroy()
+    {
+      while (constructed != 0U)
+      {
+        --constructed;
+        p_buffer[constructed].~T();
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Stores a value in a slot.
+    /// Slots are filled in order, so any slot below 'constructed' already holds
+    /// a value and is assigned to.
+    //*************************************************************************
+    void store(size_type index, const_reference value)
+    {
+      if (index < constructed)
+      {
+        p_buffer[index] = value;
+      }
+      else
+      {
+        ::new (&p_buffer[index]) T(value);
+        ++constructed;
+      }
+    }
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_BROADCAST_BUFFER_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Stores a value in a slot.
+    //*************************************************************************
+    void store(size_type index, rvalue_reference value)
+    {
+      if (index < constructed)
+      {
+        p_buffer[index] = etl::move(value);
+      }
+      else
+      {
+        ::new (&p_buffer[index]) T(etl::move(value));
+        ++constructed;
+      }
+    }
+  #endif
+
+    //*************************************************************************
+    /// Loads a consumer's read index.
+    /// When 'Overwrite' is true the producer may have moved the cursor, so the
+    /// load must synchronise with it.
+    //*************************************************************************
+    static size_type load_cursor(const cursor_type& cursor)
+    {
+      return cursor.read.load(Overwrite ? etl::memory_order_acquire : etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// How many items can be read by the consumer.
+    /// When 'Overwrite' is true the cached write index may be older than a
+    /// cursor that the producer has moved, so it is always reloaded.
+    //*************************************************************************
+    size_type get_read_available(cursor_type& cursor, size_type read_index, size_type wanted)
+    {
+      return base_t::get_read_available(cursor, read_index, Overwrite ? Reserved : wanted);
+    }
+
+    //*************************************************************************
+    /// Moves a consumer's cursor on by 'n' items.
+    /// If 'Overwrite' is true and the producer has moved the cursor, then
+    /// 'read_index' is updated and false is returned.
+    //*************************************************************************
+    bool advance_cursor(cursor_type& cursor, size_type& read_index, size_type n)
+    {
+      size_type next_index = etl::private_ring_index::advance(read_index, n, Reserved);
+
+      if (Overwrite)
+      {
+        return cursor.read.compare_exchange_strong(read_index, next_index, etl::memory_order_release, etl::memory_order_acquire);
+      }
+      else
+      {
+        cursor.read.store(next_index, etl::memory_order_release);
+        return true;
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a region of 'n' items starting at 'index'.
+    //*************************************************************************
+    region_type make_region(size_type index, size_type n) const
+    {
+      size_type first_size = etl::min(n, size_type(Reserved - index));
+
+      return region_type(etl::span<const T>(p_buffer + index, first_size), etl::span<const T>(p_buffer, size_type(n - first_size)));
+    }
+
+    // Disable copy construction and assignment.
+    ibroadcast_buffer_spmc_atomic(const ibroadcast_buffer_spmc_atomic&) ETL_DELETE;
+    ibroadcast_buffer_spmc_atomic& operator=(const ibroadcast_buffer_spmc_atomic&) ETL_DELETE;
+
+  #if ETL_USING_CPP11
+    ibroadcast_buffer_spmc_atomic(ibroadcast_buffer_spmc_atomic&&)            = delete;
+    ibroadcast_buffer_spmc_atomic& operator=(ibroadcast_buffer_spmc_atomic&&) = delete;
+  #endif
+
+    T* const  p_buffer;    ///< The buffer of items.
+    size_type constructed; ///< The number of slots that hold a value. Only accessed by the producer.
+  };
+
+  //***************************************************************************
+  ///\ingroup broadcast_buffer_spmc_atomic
+  /// A fixed capacity single producer, multiple consumer broadcast buffer.
+  /// Every consumer reads every item, and each item is only stored once.
+  /// \tparam T                   The type this buffer should support.
+  /// \tparam Size                The maximum capacity of the buffer.
+  /// \tparam N_Consumers         The number of consumers.
+  /// \tparam Overwrite           Whether the producer overwrites items that have not been read by all consumers.
+  /// \tparam Memory_Model        The memory model for the buffer. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t Size, size_t N_Consumers, bool Overwrite = false, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class broadcast_buffer_spmc_atomic : public ibroadcast_buffer_spmc_atomic<T, Overwrite, Memory_Model>
+  {
+  private:
+
+    typedef typename etl::ibroadcast_buffer_spmc_atomic<T, Overwrite, Memory_Model> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+  private:
+
+    static ETL_CONSTANT size_type Reserved_Size = size_type(Size + 1);
+
+  public:
+
+    ETL_STATIC_ASSERT((Size <= (etl::integral_limits<size_type>::max - 1)), "Size too large for memory model");
+    ETL_STATIC_ASSERT((N_Consumers > 0), "There must be at least one consumer");
+
+    static ETL_CONSTANT size_type MAX_SIZE            = size_type(Size);
+    static ETL_CONSTANT size_t    NUMBER_OF_CONSUMERS = N_Consumers;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    broadcast_buffer_spmc_atomic()
+      : base_t(reinterpret_cast<T*>(&buffer[0]), cursors, N_Consumers, Reserved_Size)
+    {
+      // The cursors are constructed after the base.
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~broadcast_buffer_spmc_atomic()
+    {
+      base_t::destroy();
+    }
+
+  private:
+
+    /// The consumers' read positions.
+    typename base_t::cursor_type cursors[N_Consumers];
+
+    /// The uninitialised buffer of T.
+    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[Reserved_Size];
+  };
+
+  template <typename T, size_t Size, size_t N_Consumers, bool Overwrite, const size_t Memory_Model>
+  ETL_CONSTANT typename broadcast_buffer_spmc_atomic<T, Size, N_Consumers, Overwrite, Memory_Model>::size_type
+    broadcast_buffer_spmc_atomic<T, Size, N_Consumers, Overwrite, Memory_Model>::MAX_SIZE;
+
+  template <typename T, size_t Size, size_t N_Consumers, bool Overwrite, const size_t Memory_Model>
+  ETL_CONSTANT size_t broadcast_buffer_spmc_atomic<T, Size, N_Consumers, Overwrite, Memory_Model>::NUMBER_OF_CONSUMERS;
+} // namespace etl
+
+#endif
+
+#endif
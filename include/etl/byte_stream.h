@@ -45,9 +45,160 @@ SOFTWARE.
 #include "type_traits.h"
 
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+/// SSSE3 support for reversing the bytes of ranges of values.
+/// Define ETL_NO_BYTE_STREAM_SIMD to use the portable code.
+//*****************************************************************************
+#if ETL_USING_SSSE3 && !defined(ETL_NO_BYTE_STREAM_SIMD)
+  #define ETL_USING_BYTE_STREAM_SSSE3 1
+  #include <tmmintrin.h>
+#else
+  #define ETL_USING_BYTE_STREAM_SSSE3 0
+#endif
 
 namespace etl
 {
+  namespace private_byte_stream
+  {
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Reverses the bytes of each value in a 64 bit word.
+    //*************************************************************************
+    template <size_t Size>
+    uint64_t reverse_bytes_in_word(uint64_t word);
+
+    template <>
+    inline uint64_t reverse_bytes_in_word<2U>(uint64_t word)
+    {
+      return ((word & 0x00FF00FF00FF00FFULL) << 8U) | ((word >> 8U) & 0x00FF00FF00FF00FFULL);
+    }
+
+    template <>
+    inline uint64_t reverse_bytes_in_word<4U>(uint64_t word)
+    {
+      word = reverse_bytes_in_word<2U>(word);
+
+      return ((word & 0x0000FFFF0000FFFFULL) << 16U) | ((word >> 16U) & 0x0000FFFF0000FFFFULL);
+    }
+
+    template <>
+    inline uint64_t reverse_bytes_in_word<8U>(uint64_t word)
+    {
+      return etl::reverse_bytes(word);
+    }
+#endif
+
+#if ETL_USING_BYTE_STREAM_SSSE3
+    //*************************************************************************
+    /// The shuffle that reverses the bytes of each value in 16 bytes.
+    //*************************************************************************
+    template <size_t Size>
+    __m128i reverse_bytes_shuffle();
+
+    template <>
+    inline __m128i reverse_bytes_shuffle<2U>()
+    {
+      return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    }
+
+    template <>
+    inline __m128i reverse_bytes_shuffle<4U>()
+    {
+      return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    }
+
+    template <>
+    inline __m128i reverse_bytes_shuffle<8U>()
+    {
+      return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    }
+#endif
+
+    //*************************************************************************
+    /// Copies 'n' values of 'Size' bytes, reversing the bytes of each.
+    /// Sixteen bytes are reversed at a time with SSSE3, otherwise eight
+    /// if 64 bit types are available.
+    //*************************************************************************
+    template <size_t Size>
+    typename etl::enable_if<(Size == 2U) || (Size == 4U) || (Size == 8U), void>::type copy_reversed(const char* source, char* destination, size_t n)
+    {
+      size_t length = n * Size;
+
+#if ETL_USING_BYTE_STREAM_SSSE3
+      const __m128i shuffle = reverse_bytes_shuffle<Size>();
+
+      while (length >= 16U)
+      {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_shuffle_epi8(values, shuffle));
+
+        source += 16U;
+        destination += 16U;
+        length -= 16U;
+      }
+#endif
+
+#if ETL_USING_64BIT_TYPES
+      while (length >= 8U)
+      {
+        uint64_t word;
+        memcpy(&word, source, sizeof(word));
+        word = reverse_bytes_in_word<Size>(word);
+        memcpy(destination, &word, sizeof(word));
+
+        source += 8U;
+        destination += 8U;
+        length -= 8U;
+      }
+#endif
+
+      while (length != 0U)
+      {
+        etl::reverse_copy(source, source + Size, destination);
+
+        source += Size;
+        destination += Size;
+        length -= Size;
+      }
+    }
+
+    //*************************************************************************
+    /// Copies 'n' values of 'Size' bytes, reversing the bytes of each.
+    //*************************************************************************
+    template <size_t Size>
+    typename etl::enable_if<(Size != 2U) && (Size != 4U) && (Size != 8U), void>::type copy_reversed(const char* source, char* destination, size_t n)
+    {
+      while (n-- != 0U)
+      {
+        etl::reverse_copy(source, source + Size, destination);
+
+        source += Size;
+        destination += Size;
+      }
+    }
+
+    //*************************************************************************
+    /// Copies 'n' values of 'Size' bytes from a buffer of 'endianness'.
+    //*************************************************************************
+    template <size_t Size>
+    void copy_values(const char* source, char* destination, size_t n, etl::endian endianness)
+    {
+      const etl::endian platform_endianness = etl::endianness::value();
+
+      if ((Size == 1U) || (endianness == platform_endianness))
+      {
+        etl::mem_copy(source, n * Size, destination);
+      }
+      else
+      {
+        copy_reversed<Size>(source, destination, n);
+      }
+    }
+  } // namespace private_byte_stream
+
   //***************************************************************************
   /// Encodes a byte stream.
   //***************************************************************************
@@ -175,13 +326,7 @@ namespace etl
     template <typename T>
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type write_unchecked(const etl::span<T>& range)
     {
-      typename etl::span<T>::iterator itr = range.begin();
-
-      while (itr != range.end())
-      {
-        to_bytes(*itr);
-        ++itr;
-      }
+      range_to_bytes(range.data(), range.size());
     }
 
     //***************************************************************************
@@ -206,11 +351,7 @@ namespace etl
     template <typename T>
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type write_unchecked(const T* start, size_t length)
     {
-      while (length-- != 0U)
-      {
-        to_bytes(*start);
-        ++start;
-      }
+      range_to_bytes(start, length);
     }
 
     //***************************************************************************
@@ -445,6 +586,17 @@ namespace etl
       step(sizeof(T));
     }
 
+    //*********************************
+    template <typename T>
+    void range_to_bytes(const T* start, size_t length)
+    {
+      if (length != 0U)
+      {
+        private_byte_stream::copy_values<sizeof(T)>(reinterpret_cast<const char*>(start), pcurrent, length, stream_endianness);
+        step(length * sizeof(T));
+      }
+    }
+
     //*********************************
     void step(size_t n)
     {
@@ -620,12 +772,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(etl::span<T> range)
     {
-      typename etl::span<T>::iterator destination = range.begin();
-
-      while (destination != range.end())
-      {
-        *destination++ = from_bytes<T>();
-      }
+      range_from_bytes(range.data(), range.size());
 
       return etl::span<const T>(range.begin(), range.end());
     }
@@ -653,12 +800,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type read_unchecked(T*     start,
                                                                                                                                       size_t length)
     {
-      T* destination = start;
-
-      for (size_t i = 0; i < length; ++i)
-      {
-        *destination++ = from_bytes<T>();
-      }
+      range_from_bytes(start, length);
 
       return etl::span<const T>(start, length);
     }
@@ -829,6 +971,17 @@ namespace etl
       return value;
     }
 
+    //*********************************
+    template <typename T>
+    void range_from_bytes(T* start, size_t length)
+    {
+      if (length != 0U)
+      {
+        private_byte_stream::copy_values<sizeof(T)>(pcurrent, reinterpret_cast<char*>(start), length, stream_endianness);
+        pcurrent += length * sizeof(T);
+      }
+    }
+
     //*********************************
     void copy_value(const char* source, char* destination, size_t length) const
     {
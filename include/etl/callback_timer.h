@@ -201,6 +201,8 @@ namespace etl
             ETL_ENABLE_TIMER_UPDATES;
           }
 
+          cancel_dispatch(timer.id);
+
           // Reset in-place.
           new (&timer) timer_data();
           --registered_timers;
@@ -237,6 +239,8 @@ namespace etl
       active_list.clear();
       ETL_ENABLE_TIMER_UPDATES;
 
+      expired_count = 0U;
+
       for (int i = 0; i < MAX_TIMERS; ++i)
       {
         ::new (&timer_array[i]) timer_data();
@@ -279,24 +283,7 @@ namespace etl
                 insert_callback.call_if(timer.id);
               }
 
-              if (timer.p_callback != ETL_NULLPTR)
-              {
-                if (timer.cbk_type == timer_data::C_CALLBACK)
-                {
-                  // Call the C callback.
-                  reinterpret_cast<void (*)()>(timer.p_callback)();
-                }
-                else if (timer.cbk_type == timer_data::IFUNCTION)
-                {
-                  // Call the function wrapper callback.
-                  (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
-                }
-                else if (timer.cbk_type == timer_data::DELEGATE)
-                {
-                  // Call the delegate callback.
-                  (*reinterpret_cast<callback_type*>(timer.p_callback))();
-                }
-              }
+              call(timer);
 
               has_active = !active_list.empty();
             }
@@ -315,6 +302,95 @@ namespace etl
       return false;
     }
 
+    //*******************************************
+    /// An alternative to 'tick' for large counts, such as after a long
+    /// period with the timer interrupt disabled.
+    /// All of the timers that are due within the count are removed from the
+    /// active list in one pass, and the repeating timers are restarted,
+    /// before any callback is called. The callbacks are then called in the
+    /// order in which the timers were due.
+    /// A repeating timer that was due more than once is only called once,
+    /// and keeps its phase. A timer started by a callback is timed from the
+    /// end of the count. A timer that is stopped, restarted or unregistered
+    /// by an earlier callback is not called.
+    /// If 'coalesce_' is true, timers with the same callback and period as an
+    /// earlier timer in the batch are not called.
+    /// Needs a batch buffer, as provided by etl::callback_timer_batched.
+    /// Without one, calls 'tick'.
+    /// Returns true if the tick was processed,
+    /// false if not.
+    //*******************************************
+    bool tick_batch(uint32_t count, bool coalesce_ = false)
+    {
+      if (expired_ids == ETL_NULLPTR)
+      {
+        return tick(count);
+      }
+
+      if (enabled)
+      {
+        if (ETL_TIMER_UPDATES_ENABLED)
+        {
+          expired_count = active_list.remove_expired(count, expired_ids);
+
+          // Restart the repeating timers.
+          // Timers with the same period are restarted in order, so each may
+          // be inserted after the last.
+          etl::timer::id::type last_id    = etl::timer::id::NO_TIMER;
+          uint32_t             last_delay = 0U;
+
+          for (uint_least8_t i = 0U; i < expired_count; ++i)
+          {
+            timer_data& timer = timer_array[expired_ids[i]];
+
+            // The time since the timer was due.
+            const uint32_t late = timer.delta;
+
+            timer.set_inactive();
+            remove_callback.call_if(timer.id);
+
+            if (timer.repeating)
+            {
+              // Skip the periods that have passed.
+              timer.delta = (timer.period == 0U) ? 0U : timer.period - (late % timer.period);
+
+              const uint32_t delay = timer.delta;
+
+              active_list.insert_after(timer.id, last_id, last_delay);
+              insert_callback.call_if(timer.id);
+
+              last_id    = timer.id;
+              last_delay = delay;
+            }
+          }
+
+          if (coalesce_)
+          {
+            coalesce();
+          }
+
+          // Callbacks may modify the timers, so take one at a time.
+          expired_index = 0U;
+
+          while (expired_index < expired_count)
+          {
+            const etl::timer::id::type id = expired_ids[expired_index++];
+
+            if (id != etl::timer::id::NO_TIMER)
+            {
+              call(timer_array[id]);
+            }
+          }
+
+          expired_count = 0U;
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
     //*******************************************
     /// Starts a timer.
     //*******************************************
@@ -345,6 +421,8 @@ namespace etl
             insert_callback.call_if(timer.id);
             ETL_ENABLE_TIMER_UPDATES;
 
+            cancel_dispatch(timer.id);
+
             result = true;
           }
         }
@@ -376,6 +454,8 @@ namespace etl
             ETL_ENABLE_TIMER_UPDATES;
           }
 
+          cancel_dispatch(timer.id);
+
           result = true;
         }
       }
@@ -599,6 +679,29 @@ namespace etl
     icallback_timer(timer_data* const timer_array_, const uint_least8_t Max_Timers_)
       : timer_array(timer_array_)
       , active_list(timer_array_)
+      , expired_ids(ETL_NULLPTR)
+      , expired_count(0U)
+      , expired_index(0U)
+      , enabled(false)
+      ,
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+      process_semaphore(0)
+      ,
+#endif
+      registered_timers(0)
+      , MAX_TIMERS(Max_Timers_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with a buffer of Max_Timers_ ids for tick_batch.
+    //*******************************************
+    icallback_timer(timer_data* const timer_array_, etl::timer::id::type* const expired_ids_, const uint_least8_t Max_Timers_)
+      : timer_array(timer_array_)
+      , active_list(timer_array_)
+      , expired_ids(expired_ids_)
+      , expired_count(0U)
+      , expired_index(0U)
       , enabled(false)
       ,
 #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
@@ -620,6 +723,75 @@ namespace etl
       return (id_ < MAX_TIMERS);
     }
 
+    //*******************************************
+    /// Calls the timer's callback.
+    //*******************************************
+    void call(const timer_data& timer)
+    {
+      if (timer.p_callback != ETL_NULLPTR)
+      {
+        if (timer.cbk_type == timer_data::C_CALLBACK)
+        {
+          // Call the C callback.
+          reinterpret_cast<void (*)()>(timer.p_callback)();
+        }
+        else if (timer.cbk_type == timer_data::IFUNCTION)
+        {
+          // Call the function wrapper callback.
+          (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
+        }
+        else if (timer.cbk_type == timer_data::DELEGATE)
+        {
+          // Call the delegate callback.
+          (*reinterpret_cast<callback_type*>(timer.p_callback))();
+        }
+      }
+    }
+
+    //*******************************************
+    /// Removes the expired timers with the same callback and period as an
+    /// earlier one.
+    //*******************************************
+    void coalesce()
+    {
+      uint_least8_t kept = 0U;
+
+      for (uint_least8_t i = 0U; i < expired_count; ++i)
+      {
+        const timer_data& timer = timer_array[expired_ids[i]];
+
+        bool is_duplicate = false;
+
+        for (uint_least8_t j = 0U; !is_duplicate && (j < kept); ++j)
+        {
+          const timer_data& other = timer_array[expired_ids[j]];
+
+          is_duplicate = (timer.p_callback == other.p_callback) && (timer.cbk_type == other.cbk_type) && (timer.period == other.period);
+        }
+
+        if (!is_duplicate)
+        {
+          expired_ids[kept++] = expired_ids[i];
+        }
+      }
+
+      expired_count = kept;
+    }
+
+    //*******************************************
+    /// Stops a timer being called by tick_batch, if it has not yet been.
+    //*******************************************
+    void cancel_dispatch(etl::timer::id::type id_)
+    {
+      for (uint_least8_t i = expired_index; i < expired_count; ++i)
+      {
+        if (expired_ids[i] == id_)
+        {
+          expired_ids[i] = etl::timer::id::NO_TIMER;
+        }
+      }
+    }
+
     //*************************************************************************
     class timer_list
     {
@@ -643,66 +815,70 @@ namespace etl
       // Inserts the timer at the correct delta position
       //*******************************
       void insert(etl::timer::id::type id_)
+      {
+        insert_from(id_, begin());
+      }
+
+      //*******************************
+      // Inserts the timer at the correct delta position, searching from the
+      // timer after 'last_id', which is due in 'last_delay'.
+      // If the timer is due before then, searches from the start.
+      //*******************************
+      void insert_after(etl::timer::id::type id_, etl::timer::id::type last_id, uint32_t last_delay)
       {
         timer_data& timer = ptimers[id_];
 
-        if (head == etl::timer::id::NO_TIMER)
+        if ((last_id == etl::timer::id::NO_TIMER) || (timer.delta < last_delay))
         {
-          // No entries yet.
-          head           = id_;
-          tail           = id_;
-          timer.previous = etl::timer::id::NO_TIMER;
-          timer.next     = etl::timer::id::NO_TIMER;
+          insert_from(id_, begin());
         }
         else
         {
-          // We already have entries.
-          etl::timer::id::type test_id = begin();
-
-          while (test_id != etl::timer::id::NO_TIMER)
-          {
-            timer_data& test = ptimers[test_id];
+          timer.delta -= last_delay;
+          insert_from(id_, next(last_id));
+        }
+      }
 
-            // Find the correct place to insert.
-            if (timer.delta <= test.delta)
-            {
-              if (test.id == head)
-              {
-                head = timer.id;
-              }
+      //*******************************
+      // Removes the timers that are due within 'count' and writes their ids
+      // to 'ids', in the order that they are due.
+      // The delta of each removed timer is set to the time from when it was
+      // due to the end of the count.
+      // Returns the number of timers removed.
+      //*******************************
+      uint_least8_t remove_expired(uint32_t count, etl::timer::id::type* ids)
+      {
+        uint_least8_t        n       = 0U;
+        uint32_t             elapsed = 0U;
+        etl::timer::id::type id      = begin();
 
-              // Insert before test.
-              timer.previous = test.previous;
-              test.previous  = timer.id;
-              timer.next     = test.id;
+        while ((id != etl::timer::id::NO_TIMER) && ((count - elapsed) >= ptimers[id].delta))
+        {
+          timer_data& timer = ptimers[id];
 
-              // Adjust the next delta to compensate.
-              test.delta -= timer.delta;
+          elapsed += timer.delta;
+          timer.delta = count - elapsed;
+          ids[n++]    = id;
+          id          = timer.next;
 
-              if (timer.previous != etl::timer::id::NO_TIMER)
-              {
-                ptimers[timer.previous].next = timer.id;
-              }
-              break;
-            }
-            else
-            {
-              timer.delta -= test.delta;
-            }
+          timer.previous = etl::timer::id::NO_TIMER;
+          timer.next     = etl::timer::id::NO_TIMER;
+        }
 
-            test_id = next(test_id);
-          }
+        // The rest of the list.
+        head = id;
 
-          // Reached the end?
-          if (test_id == etl::timer::id::NO_TIMER)
-          {
-            // Tag on to the tail.
-            ptimers[tail].next = timer.id;
-            timer.previous     = tail;
-            timer.next         = etl::timer::id::NO_TIMER;
-            tail               = timer.id;
-          }
+        if (id == etl::timer::id::NO_TIMER)
+        {
+          tail = etl::timer::id::NO_TIMER;
         }
+        else
+        {
+          ptimers[id].previous = etl::timer::id::NO_TIMER;
+          ptimers[id].delta -= (count - elapsed);
+        }
+
+        return n;
       }
 
       //*******************************
@@ -784,6 +960,71 @@ namespace etl
 
     private:
 
+      //*******************************
+      // Inserts the timer at the correct delta position, searching from
+      // 'test_id'. The timer's delta is relative to the timer before it.
+      //*******************************
+      void insert_from(etl::timer::id::type id_, etl::timer::id::type test_id)
+      {
+        timer_data& timer = ptimers[id_];
+
+        if (head == etl::timer::id::NO_TIMER)
+        {
+          // No entries yet.
+          head           = id_;
+          tail           = id_;
+          timer.previous = etl::timer::id::NO_TIMER;
+          timer.next     = etl::timer::id::NO_TIMER;
+        }
+        else
+        {
+          // We already have entries.
+          while (test_id != etl::timer::id::NO_TIMER)
+          {
+            timer_data& test = ptimers[test_id];
+
+            // Find the correct place to insert.
+            if (timer.delta <= test.delta)
+            {
+              if (test.id == head)
+              {
+                head = timer.id;
+              }
+
+              // Insert before test.
+              timer.previous = test.previous;
+              test.previous  = timer.id;
+              timer.next     = test.id;
+
+              // Adjust the next delta to compensate.
+              test.delta -= timer.delta;
+
+              if (timer.previous != etl::timer::id::NO_TIMER)
+              {
+                ptimers[timer.previous].next = timer.id;
+              }
+              break;
+            }
+            else
+            {
+              timer.delta -= test.delta;
+            }
+
+            test_id = next(test_id);
+          }
+
+          // Reached the end?
+          if (test_id == etl::timer::id::NO_TIMER)
+          {
+            // Tag on to the tail.
+            ptimers[tail].next = timer.id;
+            timer.previous     = tail;
+            timer.next         = etl::timer::id::NO_TIMER;
+            tail               = timer.id;
+          }
+        }
+      }
+
       etl::timer::id::type head;
       etl::timer::id::type tail;
 
@@ -796,6 +1037,11 @@ namespace etl
     // The list of active timers.
     timer_list active_list;
 
+    // The timers to be called by tick_batch. May be null.
+    etl::timer::id::type* const expired_ids;
+    uint_least8_t               expired_count;
+    uint_least8_t               expired_index;
+
     volatile bool enabled;
 #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
 
@@ -843,6 +1089,30 @@ namespace etl
 
     timer_data timer_array[Max_Timers_];
   };
+
+  //***************************************************************************
+  /// The callback timer, with the buffer needed by tick_batch.
+  //***************************************************************************
+  template <const uint_least8_t Max_Timers_>
+  class callback_timer_batched : public etl::icallback_timer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Timers_ <= 254, "No more than 254 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_batched()
+      : icallback_timer(timer_array, expired_array, Max_Timers_)
+    {
+    }
+
+  private:
+
+    timer_data           timer_array[Max_Timers_];
+    etl::timer::id::type expired_array[Max_Timers_];
+  };
 } // namespace etl
 
 #undef ETL_DISABLE_TIMER_UPDATES
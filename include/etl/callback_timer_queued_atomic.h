@@ -0,0 +1,217 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_QUEUED_ATOMIC_INCLUDED
+#define ETL_CALLBACK_TIMER_QUEUED_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "callback_timer_atomic.h"
+#include "intrusive_links.h"
+#include "intrusive_queue_mpsc_atomic.h"
+#include "static_assert.h"
+#include "timer.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A callback timer where other threads start and stop timers through a
+  /// lock free command queue.
+  /// etl::callback_timer_atomic skips a tick while another thread is
+  /// modifying the active list. Here, queue_start() and queue_stop() post the
+  /// request to the timer, and the thread that calls tick_queued() applies the
+  /// requests before it processes the expiries. The active list is only
+  /// modified by the tick thread, so a tick is never skipped, and the posting
+  /// thread never waits.
+  /// The timer must be ticked with tick_queued(). The base class tick() does
+  /// not apply the requests, so it is not accessible from this class.
+  /// Each timer has one pending request. A later request for a timer replaces
+  /// one that has not yet been applied, so the queue can never overflow.
+  /// All other member functions must only be called from the tick thread.
+  //***************************************************************************
+  template <uint_least8_t Max_Timers_, typename TSemaphore>
+  class callback_timer_queued_atomic : public etl::icallback_timer_atomic<TSemaphore>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Timers_ <= 254U, "No more than 254 timers are allowed");
+
+    typedef typename etl::icallback_timer_atomic<TSemaphore>::callback_type       callback_type;
+    typedef typename etl::icallback_timer_atomic<TSemaphore>::event_callback_type event_callback_type;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_queued_atomic()
+      : etl::icallback_timer_atomic<TSemaphore>(timer_array, Max_Timers_)
+    {
+    }
+
+    //*******************************************
+    /// Requests that a timer is started on the next call to tick_queued().
+    /// May be called from any thread or interrupt.
+    /// The request takes effect as if start() had been called just before
+    /// the next tick.
+    /// Returns <b>false</b> if the id is not valid.
+    //*******************************************
+    bool queue_start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      return post(id_, immediate_ ? Start_Immediate : Start);
+    }
+
+    //*******************************************
+    /// Requests that a timer is stopped on the next call to tick_queued().
+    /// May be called from any thread or interrupt.
+    /// Returns <b>false</b> if the id is not valid.
+    //*******************************************
+    bool queue_stop(etl::timer::id::type id_)
+    {
+      return post(id_, Stop);
+    }
+
+    //*******************************************
+    /// Applies the queued requests, then processes the expiries.
+    /// Used in place of tick().
+    /// Returns true if the tick was processed, false if not.
+    //*******************************************
+    bool tick_queued(uint32_t count)
+    {
+      apply_commands();
+
+      return etl::icallback_timer_atomic<TSemaphore>::tick(count);
+    }
+
+    //*******************************************
+    /// Applies the queued requests without waiting for the next tick.
+    /// Must only be called from the tick thread.
+    //*******************************************
+    void apply_commands()
+    {
+      // A timer is only in the queue once, so this bounds the work when
+      // requests are posted as fast as they are applied.
+      for (uint_least8_t i = 0U; (i < Max_Timers_) && !command_queue.empty(); ++i)
+      {
+        command_node& node = command_queue.front();
+        command_queue.pop();
+
+        const etl::timer::id::type id = static_cast<etl::timer::id::type>(&node - commands);
+
+        // Take the most recent request. Another may now be posted.
+        switch (node.command.exchange(No_Command, etl::memory_order_acq_rel))
+        {
+          case Start:
+          {
+            this->start(id, false);
+            break;
+          }
+
+          case Start_Immediate:
+          {
+            this->start(id, true);
+            break;
+          }
+
+          case Stop:
+          {
+            this->stop(id);
+            break;
+          }
+
+          default:
+          {
+            break;
+          }
+        }
+      }
+    }
+
+  private:
+
+    // Does not apply the queued requests. Use tick_queued().
+    using etl::icallback_timer_atomic<TSemaphore>::tick;
+
+    typedef typename etl::icallback_timer_atomic<TSemaphore>::timer_data timer_data;
+
+    enum
+    {
+      No_Command,
+      Start,
+      Start_Immediate,
+      Stop
+    };
+
+    //*******************************************
+    /// The pending request for a timer.
+    //*******************************************
+    struct command_node : public etl::forward_link<0>
+    {
+      command_node()
+        : command(No_Command)
+      {
+      }
+
+      etl::atomic<uint_least8_t> command;
+    };
+
+    typedef etl::intrusive_queue_mpsc_atomic<command_node, etl::forward_link<0> > command_queue_type;
+
+    //*******************************************
+    /// Posts a request, queuing the timer if it has no other pending request.
+    //*******************************************
+    bool post(etl::timer::id::type id_, uint_least8_t command_)
+    {
+      if (id_ >= Max_Timers_)
+      {
+        return false;
+      }
+
+      command_node& node = commands[id_];
+
+      // Only the thread that finds no pending request queues the timer.
+      if (node.command.exchange(command_, etl::memory_order_acq_rel) == No_Command)
+      {
+        command_queue.push(node);
+      }
+
+      return true;
+    }
+
+    timer_data         timer_array[Max_Timers_];
+    command_node       commands[Max_Timers_];
+    command_queue_type command_queue;
+  };
+} // namespace etl
+
+#endif
+#endif
@@ -0,0 +1,733 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "delegate.h"
+#include "error_handler.h"
+#include "function.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "type_traits.h"
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+#if defined(ETL_IN_UNIT_TEST) && ETL_NOT_USING_STL
+  #define ETL_DISABLE_TIMER_UPDATES ((void)0)
+  #define ETL_ENABLE_TIMER_UPDATES  ((void)0)
+  #define ETL_TIMER_UPDATES_ENABLED true
+
+  #undef ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+  #undef ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+#else
+  #if !defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && !defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK not defined
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error Only define one of ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+    #define ETL_DISABLE_TIMER_UPDATES (++process_semaphore)
+    #define ETL_ENABLE_TIMER_UPDATES  (--process_semaphore)
+    #define ETL_TIMER_UPDATES_ENABLED (process_semaphore.load() == 0)
+  #endif
+#endif
+
+#if defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+  #if !defined(ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS) || !defined(ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS)
+    #error ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS and/or ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS not defined
+  #endif
+
+  #define ETL_DISABLE_TIMER_UPDATES ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS
+  #define ETL_ENABLE_TIMER_UPDATES  ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS
+  #define ETL_TIMER_UPDATES_ENABLED true
+#endif
+
+#if ETL_USING_64BIT_TYPES
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for the timing wheel callback timer.
+  /// A drop in alternative to etl::icallback_timer for large numbers of
+  /// timers. The active timers are held in a hierarchical timing wheel, rather
+  /// than a sorted list, so starting and stopping a timer take constant time,
+  /// whatever the number of active timers. Each tick costs constant time when
+  /// no timer is due. Timers are moved to a finer level of the wheel at most
+  /// once per level before they expire.
+  /// The timer ids are of type TId, which sets the number of timers that may
+  /// be registered. The largest value of TId is used as 'no timer'.
+  /// Requires 64 bit integral types for the wheel's time.
+  //***************************************************************************
+  template <typename TId = etl::timer::id::type>
+  class icallback_timer_wheel
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_unsigned<TId>::value, "The timer id type must be unsigned");
+
+    typedef TId id_type;
+
+    static ETL_CONSTANT id_type NO_TIMER = etl::integral_limits<id_type>::max;
+
+    typedef etl::delegate<void(void)> callback_type;
+
+    typedef etl::delegate<void(id_type)> event_callback_type;
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    id_type register_timer(void (*p_callback_)(), uint32_t period_, bool repeating_)
+    {
+      id_type id = NO_TIMER;
+
+      bool is_space = (registered_timers < MAX_TIMERS);
+
+      if (is_space)
+      {
+        // Search for the free space.
+        for (id_type i = 0U; i < MAX_TIMERS; ++i)
+        {
+          timer_data& timer = timer_array[i];
+
+          if (timer.id == NO_TIMER)
+          {
+            // Create in-place.
+            new (&timer) timer_data(i, p_callback_, period_, repeating_);
+            ++registered_timers;
+            id = i;
+            break;
+          }
+        }
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    id_type register_timer(etl::ifunction<void>& callback_, uint32_t period_, bool repeating_)
+    {
+      id_type id = NO_TIMER;
+
+      bool is_space = (registered_timers < MAX_TIMERS);
+
+      if (is_space)
+      {
+        // Search for the free space.
+        for (id_type i = 0U; i < MAX_TIMERS; ++i)
+        {
+          timer_data& timer = timer_array[i];
+
+          if (timer.id == NO_TIMER)
+          {
+            // Create in-place.
+            new (&timer) timer_data(i, callback_, period_, repeating_);
+            ++registered_timers;
+            id = i;
+            break;
+          }
+        }
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+#if ETL_USING_CPP11
+    id_type register_timer(callback_type& callback_, uint32_t period_, bool repeating_)
+    {
+      id_type id = NO_TIMER;
+
+      bool is_space = (registered_timers < MAX_TIMERS);
+
+      if (is_space)
+      {
+        // Search for the free space.
+        for (id_type i = 0U; i < MAX_TIMERS; ++i)
+        {
+          timer_data& timer = timer_array[i];
+
+          if (timer.id == NO_TIMER)
+          {
+            // Create in-place.
+            new (&timer) timer_data(i, callback_, period_, repeating_);
+            ++registered_timers;
+            id = i;
+            break;
+          }
+        }
+      }
+
+      return id;
+    }
+#endif
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(id_type id_)
+    {
+      bool result = false;
+
+      if (is_valid_timer_id(id_))
+      {
+        timer_data& timer = timer_array[id_];
+
+        if (timer.id != NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            wheel.remove(timer.id);
+            remove_callback.call_if(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          // Reset in-place.
+          new (&timer) timer_data();
+          --registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      wheel.clear();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      for (id_type i = 0U; i < MAX_TIMERS; ++i)
+      {
+        ::new (&timer_array[i]) timer_data();
+      }
+
+      registered_timers = 0;
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (ETL_TIMER_UPDATES_ENABLED)
+        {
+          const uint64_t end_time = wheel.now() + count;
+
+          uint64_t       event_time;
+          uint_least16_t slot = wheel.next_slot(event_time);
+
+          // Visit each slot that is due, in time order.
+          while ((slot != wheel_type::No_Slot) && (event_time <= end_time))
+          {
+            wheel.set_now(event_time);
+
+            if (wheel_type::level_of(slot) == 0U)
+            {
+              expire(slot);
+            }
+            else
+            {
+              // Move the timers to the finer levels.
+              wheel.cascade(slot);
+            }
+
+            slot = wheel.next_slot(event_time);
+          }
+
+          wheel.set_now(end_time);
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(id_type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::Inactive)
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            if (timer.is_active())
+            {
+              wheel.remove(timer.id);
+              remove_callback.call_if(timer.id);
+            }
+
+            timer.expiry = wheel.now() + (immediate_ ? 0U : timer.period);
+            wheel.insert(timer.id);
+            insert_callback.call_if(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(id_type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            wheel.remove(timer.id);
+            remove_callback.call_if(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(id_type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(id_type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Check if there is an active timer.
+    //*******************************************
+    bool has_active_timer() const
+    {
+      return !wheel.empty();
+    }
+
+    //*******************************************
+    /// Get the time to the next timer event.
+    /// Returns etl::timer::interval::No_Active_Interval if there is no active
+    /// timer.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      return wheel.time_to_next(static_cast<uint32_t>(etl::timer::interval::No_Active_Interval));
+    }
+
+    //*******************************************
+    /// Checks if a timer is currently active.
+    /// Returns <b>true</b> if the timer is active, otherwise <b>false</b>.
+    //*******************************************
+    bool is_active(id_type id_) const
+    {
+      // Valid timer id?
+      if (is_valid_timer_id(id_))
+      {
+        const timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != NO_TIMER)
+        {
+          return timer.is_active();
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Set a callback when a timer is inserted on list
+    //*******************************************
+    void set_insert_callback(event_callback_type insert_)
+    {
+      insert_callback = insert_;
+    }
+
+    //*******************************************
+    /// Set a callback when a timer is removed from list
+    //*******************************************
+    void set_remove_callback(event_callback_type remove_)
+    {
+      remove_callback = remove_;
+    }
+
+    //*******************************************
+    void clear_insert_callback()
+    {
+      insert_callback.clear();
+    }
+
+    //*******************************************
+    void clear_remove_callback()
+    {
+      remove_callback.clear();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The configuration of a timer.
+    struct timer_data
+    {
+      typedef etl::delegate<void(void)> callback_type;
+
+      enum callback_type_id
+      {
+        C_CALLBACK,
+        IFUNCTION,
+        DELEGATE
+      };
+
+      enum
+      {
+        No_Slot = etl::private_timer_wheel::No_Slot
+      };
+
+      //*******************************************
+      timer_data()
+        : p_callback(ETL_NULLPTR)
+        , expiry(0U)
+        , period(0)
+        , slot(No_Slot)
+        , id(NO_TIMER)
+        , previous(NO_TIMER)
+        , next(NO_TIMER)
+        , repeating(true)
+        , cbk_type(IFUNCTION)
+      {
+      }
+
+      //*******************************************
+      /// C function callback
+      //*******************************************
+      timer_data(id_type id_, void (*p_callback_)(), uint32_t period_, bool repeating_)
+        : p_callback(reinterpret_cast<void*>(p_callback_))
+        , expiry(0U)
+        , period(period_)
+        , slot(No_Slot)
+        , id(id_)
+        , previous(NO_TIMER)
+        , next(NO_TIMER)
+        , repeating(repeating_)
+        , cbk_type(C_CALLBACK)
+      {
+      }
+
+      //*******************************************
+      /// ETL function callback
+      //*******************************************
+      timer_data(id_type id_, etl::ifunction<void>& callback_, uint32_t period_, bool repeating_)
+        : p_callback(reinterpret_cast<void*>(&callback_))
+        , expiry(0U)
+        , period(period_)
+        , slot(No_Slot)
+        , id(id_)
+        , previous(NO_TIMER)
+        , next(NO_TIMER)
+        , repeating(repeating_)
+        , cbk_type(IFUNCTION)
+      {
+      }
+
+      //*******************************************
+      /// ETL delegate callback
+      //*******************************************
+      timer_data(id_type id_, callback_type& callback_, uint32_t period_, bool repeating_)
+        : p_callback(reinterpret_cast<void*>(&callback_))
+        , expiry(0U)
+        , period(period_)
+        , slot(No_Slot)
+        , id(id_)
+        , previous(NO_TIMER)
+        , next(NO_TIMER)
+        , repeating(repeating_)
+        , cbk_type(DELEGATE)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return slot != No_Slot;
+      }
+
+      //*******************************************
+      /// Sets the timer to the inactive state.
+      //*******************************************
+      void set_inactive()
+      {
+        slot = No_Slot;
+      }
+
+      void*            p_callback;
+      uint64_t         expiry; ///< The absolute time that the timer is due.
+      uint32_t         period;
+      uint_least16_t   slot; ///< The wheel slot holding the timer.
+      id_type          id;
+      id_type          previous;
+      id_type          next;
+      bool             repeating;
+      callback_type_id cbk_type;
+
+    private:
+
+      // Disabled.
+      timer_data(const timer_data& other);
+      timer_data& operator=(const timer_data& other);
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel(timer_data* const timer_array_, const id_type Max_Timers_)
+      : timer_array(timer_array_)
+      , wheel(timer_array_)
+      , enabled(false)
+      ,
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+      process_semaphore(0)
+      ,
+#endif
+      registered_timers(0)
+      , MAX_TIMERS(Max_Timers_)
+    {
+    }
+
+  private:
+
+    //*******************************************
+    /// Check that the timer id is valid.
+    //*******************************************
+    bool is_valid_timer_id(id_type id_) const
+    {
+      return (id_ < MAX_TIMERS);
+    }
+
+    //*******************************************
+    /// Calls the callbacks of the timers in a level 0 slot.
+    /// These are all due now.
+    //*******************************************
+    void expire(uint_least16_t slot)
+    {
+      id_type id = wheel.front(slot);
+
+      // Callbacks may start or stop timers, so take one at a time.
+      while (id != NO_TIMER)
+      {
+        timer_data& timer = timer_array[id];
+
+        wheel.remove(id);
+        remove_callback.call_if(id);
+
+        if (timer.repeating)
+        {
+          // Reinsert the timer.
+          timer.expiry = wheel.now() + timer.period;
+          wheel.insert(id);
+          insert_callback.call_if(id);
+        }
+
+        if (timer.p_callback != ETL_NULLPTR)
+        {
+          if (timer.cbk_type == timer_data::C_CALLBACK)
+          {
+            // Call the C callback.
+            reinterpret_cast<void (*)()>(timer.p_callback)();
+          }
+          else if (timer.cbk_type == timer_data::IFUNCTION)
+          {
+            // Call the function wrapper callback.
+            (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
+          }
+          else if (timer.cbk_type == timer_data::DELEGATE)
+          {
+            // Call the delegate callback.
+            (*reinterpret_cast<callback_type*>(timer.p_callback))();
+          }
+        }
+
+        id = wheel.front(slot);
+      }
+    }
+
+    typedef etl::private_timer_wheel::wheel<timer_data, id_type> wheel_type;
+
+    // The array of timer data structures.
+    timer_data* const timer_array;
+
+    // The active timers.
+    wheel_type wheel;
+
+    volatile bool enabled;
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+
+  #if defined(ETL_TIMER_SEMAPHORE_TYPE)
+    typedef ETL_TIMER_SEMAPHORE_TYPE timer_semaphore_t;
+  #else
+    #if ETL_HAS_ATOMIC
+    typedef etl::atomic_uint16_t timer_semaphore_t;
+    #else
+      #error No atomic type available
+    #endif
+  #endif
+
+    mutable etl::timer_semaphore_t process_semaphore;
+#endif
+    id_type registered_timers;
+
+    event_callback_type insert_callback;
+    event_callback_type remove_callback;
+
+  public:
+
+    const id_type MAX_TIMERS;
+  };
+
+  template <typename TId>
+  ETL_CONSTANT typename icallback_timer_wheel<TId>::id_type icallback_timer_wheel<TId>::NO_TIMER;
+
+  //***************************************************************************
+  /// The timing wheel callback timer
+  /// The id type defaults to etl::timer::id::type for up to 254 timers, and
+  /// to uint_least16_t for more.
+  //***************************************************************************
+  template <uint_least16_t Max_Timers_,
+            typename TId = typename etl::conditional<(Max_Timers_ < etl::timer::id::NO_TIMER), etl::timer::id::type, uint_least16_t>::type>
+  class callback_timer_wheel : public etl::icallback_timer_wheel<TId>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Timers_ < etl::integral_limits<TId>::max, "Too many timers for the id type");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel()
+      : etl::icallback_timer_wheel<TId>(timer_array, static_cast<TId>(Max_Timers_))
+    {
+    }
+
+  private:
+
+    typename etl::icallback_timer_wheel<TId>::timer_data timer_array[Max_Timers_];
+  };
+} // namespace etl
+#endif
+
+#undef ETL_DISABLE_TIMER_UPDATES
+#undef ETL_ENABLE_TIMER_UPDATES
+#undef ETL_TIMER_UPDATES_ENABLED
+
+#endif
@@ -90,4 +90,6 @@ SOFTWARE.
 #include "crc64_ecma.h"
 #include "crc64_iso.h"
 
+#include "crc_combine.h"
+
 #endif
@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc_implementation.h"
+#include "private/crc_clmul.h"
 
 ///\defgroup crc32 32 bit CRC calculation
 ///\ingroup crc
@@ -74,5 +75,17 @@ namespace etl
   typedef etl::crc32_t<16U>  crc32_t16;
   typedef etl::crc32_t<4U>   crc32_t4;
   typedef crc32_t256         crc32;
+
+#if ETL_USING_CRC_CLMUL
+  //***************************************************************************
+  /// CRC32 calculated with carry-less multiplication.
+  //***************************************************************************
+  typedef etl::crc_clmul_type<etl::private_crc::crc32_parameters> crc32_clmul;
+#else
+  //***************************************************************************
+  /// The CPU has no carry-less multiply, so the 256 entry table is used.
+  //***************************************************************************
+  typedef crc32_t256 crc32_clmul;
+#endif
 } // namespace etl
 #endif
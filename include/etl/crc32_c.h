@@ -33,6 +33,30 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc_implementation.h"
+#include "private/crc_clmul.h"
+
+//*****************************************************************************
+/// Hardware CRC32C support.
+/// Enabled when the compiler is targeting x86 with SSE4.2, or ARM with the
+/// CRC32 extension. Define ETL_NO_HARDWARE_CRC32_C to disable.
+//*****************************************************************************
+#if ETL_USING_SSE42 && !defined(ETL_NO_HARDWARE_CRC32_C)
+  #define ETL_USING_HARDWARE_CRC32_C 1
+  #define ETL_HARDWARE_CRC32_C_X86   1
+  #include <nmmintrin.h>
+#elif ETL_USING_ARM_CRC32 && !defined(ETL_NO_HARDWARE_CRC32_C) && !defined(__ARM_BIG_ENDIAN)
+  #define ETL_USING_HARDWARE_CRC32_C 1
+  #define ETL_HARDWARE_CRC32_C_ARM   1
+  #include <arm_acle.h>
+#else
+  #define ETL_USING_HARDWARE_CRC32_C 0
+#endif
+
+#if ETL_USING_HARDWARE_CRC32_C
+  #include <stddef.h>
+  #include <stdint.h>
+  #include <string.h>
+#endif
 
 ///\defgroup crc32_c 32 bit CRC_C calculation
 ///\ingroup crc
@@ -74,5 +98,132 @@ namespace etl
   typedef etl::crc32_c_t<16U>  crc32_c_t16;
   typedef etl::crc32_c_t<4U>   crc32_c_t4;
   typedef crc32_c_t256         crc32_c;
+
+#if ETL_USING_CRC_CLMUL
+  //***************************************************************************
+  /// CRC32C calculated with carry-less multiplication.
+  //***************************************************************************
+  typedef etl::crc_clmul_type<etl::private_crc::crc32_c_parameters> crc32_c_clmul;
+#else
+  //***************************************************************************
+  /// The CPU has no carry-less multiply, so the 256 entry table is used.
+  //***************************************************************************
+  typedef crc32_c_t256 crc32_c_clmul;
+#endif
+
+#if ETL_USING_HARDWARE_CRC32_C
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// Policy for CRC32C using the CPU's CRC32C instructions.
+    /// Blocks are processed eight bytes at a time, or four on 32 bit targets.
+    //*************************************************************************
+    struct crc32_c_hardware_policy
+    {
+      typedef uint32_t value_type;
+
+      //*************************************************************************
+      uint32_t initial() const
+      {
+        return 0xFFFFFFFFUL;
+      }
+
+      //*************************************************************************
+      uint32_t add(uint32_t crc, uint8_t value) const
+      {
+  #if defined(ETL_HARDWARE_CRC32_C_X86)
+        return _mm_crc32_u8(crc, value);
+  #else
+        return __crc32cb(crc, value);
+  #endif
+      }
+
+      //*************************************************************************
+      uint32_t add_block(uint32_t crc, const uint8_t* p, size_t length) const
+      {
+  #if defined(ETL_HARDWARE_CRC32_C_X86) && (defined(__x86_64__) || defined(_M_X64))
+        uint64_t crc64 = crc;
+
+        while (length >= 8U)
+        {
+          uint64_t value;
+          memcpy(&value, p, 8U);
+          crc64 = _mm_crc32_u64(crc64, value);
+          p      += 8U;
+          length -= 8U;
+        }
+
+        crc = static_cast<uint32_t>(crc64);
+  #elif defined(ETL_HARDWARE_CRC32_C_X86)
+        while (length >= 4U)
+        {
+          uint32_t value;
+          memcpy(&value, p, 4U);
+          crc = _mm_crc32_u32(crc, value);
+          p      += 4U;
+          length -= 4U;
+        }
+  #else
+        while (length >= 8U)
+        {
+          uint64_t value;
+          memcpy(&value, p, 8U);
+          crc = __crc32cd(crc, value);
+          p      += 8U;
+          length -= 8U;
+        }
+  #endif
+
+        while (length-- != 0U)
+        {
+          crc = add(crc, *p++);
+        }
+
+        return crc;
+      }
+
+      //*************************************************************************
+      uint32_t final(uint32_t crc) const
+      {
+        return crc ^ 0xFFFFFFFFUL;
+      }
+    };
+  } // namespace private_crc
+
+  //***************************************************************************
+  /// CRC32C calculated with the CPU's CRC32C instructions.
+  //***************************************************************************
+  class crc32_c_hardware : public etl::frame_check_sequence<private_crc::crc32_c_hardware_policy>
+  {
+  public:
+
+    typedef private_crc::crc32_c_parameters parameters_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc32_c_hardware()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    crc32_c_hardware(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+#else
+  //***************************************************************************
+  /// The CPU has no CRC32C instructions, so the 256 entry table is used.
+  //***************************************************************************
+  typedef crc32_c_t256 crc32_c_hardware;
+#endif
 } // namespace etl
 #endif
@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc_implementation.h"
+#include "private/crc_clmul.h"
 
 ///\defgroup crc64_ecma 64 bit ECMA CRC calculation
 ///\ingroup crc
@@ -74,5 +75,17 @@ namespace etl
   typedef etl::crc64_ecma_t<16U>  crc64_ecma_t16;
   typedef etl::crc64_ecma_t<4U>   crc64_ecma_t4;
   typedef crc64_ecma_t256         crc64_ecma;
+
+#if ETL_USING_CRC_CLMUL
+  //***************************************************************************
+  /// CRC64 ECMA calculated with carry-less multiplication.
+  //***************************************************************************
+  typedef etl::crc_clmul_type<etl::private_crc::crc64_ecma_parameters> crc64_ecma_clmul;
+#else
+  //***************************************************************************
+  /// The CPU has no carry-less multiply, so the 256 entry table is used.
+  //***************************************************************************
+  typedef crc64_ecma_t256 crc64_ecma_clmul;
+#endif
 } // namespace etl
 #endif
@@ -0,0 +1,160 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_COMBINE_INCLUDED
+#define ETL_CRC_COMBINE_INCLUDED
+
+#include "platform.h"
+#include "binary.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup crc_combine Combines CRCs of consecutive blocks
+///\ingroup crc
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// Polynomial arithmetic modulo the CRC polynomial, in unreflected bit
+    /// order. Bit n represents x^n.
+    //*************************************************************************
+    template <typename TCrcParameters>
+    struct crc_polynomial_arithmetic
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      //*************************************************************************
+      /// Returns a * x mod P.
+      //*************************************************************************
+      static ETL_CONSTEXPR14 accumulator_type multiply_by_x(accumulator_type a)
+      {
+        const accumulator_type top_bit = accumulator_type(accumulator_type(1U) << (TCrcParameters::Accumulator_Bits - 1U));
+
+        return ((a & top_bit) != 0U) ? accumulator_type((a << 1U) ^ TCrcParameters::Polynomial) : accumulator_type(a << 1U);
+      }
+
+      //*************************************************************************
+      /// Returns a * b mod P.
+      //*************************************************************************
+      static ETL_CONSTEXPR14 accumulator_type multiply(accumulator_type a, accumulator_type b)
+      {
+        accumulator_type result = 0U;
+
+        for (size_t i = TCrcParameters::Accumulator_Bits; i-- != 0U;)
+        {
+          result = multiply_by_x(result);
+
+          if (((b >> i) & 1U) != 0U)
+          {
+            result ^= a;
+          }
+        }
+
+        return result;
+      }
+
+      //*************************************************************************
+      /// Returns x^(8n) mod P, the effect of n zero bytes.
+      //*************************************************************************
+      static ETL_CONSTEXPR14 accumulator_type x_to_the_bytes(size_t n)
+      {
+        accumulator_type result = 1U;
+        accumulator_type power  = 1U;
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          power = multiply_by_x(power);
+        }
+
+        // Square and multiply.
+        while (n != 0U)
+        {
+          if ((n & 1U) != 0U)
+          {
+            result = multiply(result, power);
+          }
+
+          power = multiply(power, power);
+          n >>= 1U;
+        }
+
+        return result;
+      }
+    };
+  } // namespace private_crc
+
+  //***************************************************************************
+  ///\ingroup crc_combine
+  /// Combines the CRCs of two consecutive blocks, A and B, into the CRC of A
+  /// followed by B, without reading the data again.
+  /// This allows blocks to be checksummed in parallel and then combined.
+  /// Takes O(log(length_b)) polynomial multiplications.
+  ///\tparam TCrc     The CRC type, such as etl::crc32.
+  ///\param crc_a     The CRC of block A.
+  ///\param crc_b     The CRC of block B.
+  ///\param length_b  The length of block B, in bytes.
+  ///\return The CRC of A followed by B.
+  //***************************************************************************
+  template <typename TCrc>
+  ETL_CONSTEXPR14 typename TCrc::value_type crc_combine(typename TCrc::value_type crc_a, typename TCrc::value_type crc_b, size_t length_b)
+  {
+    typedef typename TCrc::parameters_type                          parameters_type;
+    typedef typename parameters_type::accumulator_type              accumulator_type;
+    typedef private_crc::crc_polynomial_arithmetic<parameters_type> arithmetic;
+
+    // The initial value of the register, in its own bit order.
+    const accumulator_type initial =
+      parameters_type::Reflect ? etl::reverse_bits_const<accumulator_type, parameters_type::Initial>::value : parameters_type::Initial;
+
+    // The register after A, as if it had started from zero.
+    accumulator_type a = accumulator_type(crc_a ^ parameters_type::Xor_Out ^ initial);
+
+    // Shift it over the length of B.
+    if (parameters_type::Reflect)
+    {
+      a = etl::reverse_bits(a);
+    }
+
+    a = arithmetic::multiply(a, arithmetic::x_to_the_bytes(length_b));
+
+    if (parameters_type::Reflect)
+    {
+      a = etl::reverse_bits(a);
+    }
+
+    return accumulator_type(a ^ crc_b);
+  }
+} // namespace etl
+
+#endif
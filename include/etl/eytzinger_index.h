@@ -0,0 +1,327 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EYTZINGER_INDEX_INCLUDED
+#define ETL_EYTZINGER_INDEX_INCLUDED
+
+#include "platform.h"
+#include "bit.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "functional.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+///\defgroup eytzinger_index eytzinger_index
+/// A cache friendly lookup index for sorted maps.
+///\ingroup containers
+
+//*****************************************************************************
+/// Prefetches the keys that the search will reach four levels down.
+/// May be defined in the profile to use a platform specific prefetch, or to be
+/// empty to disable prefetching.
+//*****************************************************************************
+#if !defined(ETL_EYTZINGER_INDEX_PREFETCH)
+  #if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    #define ETL_EYTZINGER_INDEX_PREFETCH(address) __builtin_prefetch(address)
+  #else
+    #define ETL_EYTZINGER_INDEX_PREFETCH(address)
+  #endif
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup eytzinger_index
+  /// Exception base for eytzinger_index.
+  //***************************************************************************
+  class eytzinger_index_exception : public etl::exception
+  {
+  public:
+
+    eytzinger_index_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup eytzinger_index
+  /// The map has more elements than the index can hold.
+  //***************************************************************************
+  class eytzinger_index_full : public etl::eytzinger_index_exception
+  {
+  public:
+
+    eytzinger_index_full(string_type file_name_, numeric_type line_number_)
+      : eytzinger_index_exception(ETL_ERROR_TEXT("eytzinger_index:full", ETL_EYTZINGER_INDEX_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup eytzinger_index
+  /// An opt-in lookup index for a sorted map, such as etl::flat_map or
+  /// etl::const_map.
+  /// The keys are copied into Eytzinger (breadth first) order, so the first
+  /// levels of every search share the same few cache lines, and the sixteen
+  /// descendants four levels below a node are contiguous, so can be prefetched
+  /// with one cache line while the search works down to them. The search is
+  /// branch free apart from the loop.
+  /// The index holds pointers to the map's elements, so it must be rebuilt
+  /// after the map is modified.
+  ///\tparam TKey        The key type.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam VSize       The maximum number of elements.
+  ///\tparam TKeyCompare The key comparison. Must match the map's.
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t VSize, typename TKeyCompare = etl::less<TKey> >
+  class eytzinger_index
+  {
+  public:
+
+    typedef TKey                                   key_type;
+    typedef TMapped                                mapped_type;
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TKeyCompare                            key_compare;
+    typedef const value_type*                      const_pointer;
+    typedef size_t                                 size_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = VSize;
+
+    //*************************************************************************
+    /// Constructs an empty index.
+    //*************************************************************************
+    ETL_CONSTEXPR14 eytzinger_index() ETL_NOEXCEPT
+      : keys()
+      , elements()
+      , element_count(0U)
+      , kcompare()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs an index for a map.
+    //*************************************************************************
+    template <typename TMap>
+    ETL_CONSTEXPR14 explicit eytzinger_index(const TMap& map)
+      : keys()
+      , elements()
+      , element_count(0U)
+      , kcompare()
+    {
+      build(map.begin(), map.end());
+    }
+
+    //*************************************************************************
+    /// Builds the index for a map.
+    //*************************************************************************
+    template <typename TMap>
+    ETL_CONSTEXPR14 void build(const TMap& map)
+    {
+      build(map.begin(), map.end());
+    }
+
+    //*************************************************************************
+    /// Builds the index from a range of elements, sorted by key.
+    /// If asserts or exceptions are enabled, emits an etl::eytzinger_index_full
+    /// if the range has more elements than the capacity of the index.
+    /// Otherwise, only the elements up to the capacity are used.
+    /// Any forward iterator may be used.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 void build(TIterator first, TIterator last)
+    {
+      element_count = 0U;
+
+      // Count the elements.
+      TIterator itr = first;
+
+      while ((itr != last) && (element_count < VSize))
+      {
+        ++element_count;
+        ++itr;
+      }
+
+      ETL_ASSERT(itr == last, ETL_ERROR(eytzinger_index_full));
+
+      if (element_count == 0U)
+      {
+        return;
+      }
+
+      // Visit the nodes in order, starting with the leftmost.
+      size_t node = leftmost(1U);
+
+      for (size_t i = 0U; i < element_count; ++i, ++first)
+      {
+        keys[node]     = first->first;
+        elements[node] = &*first;
+
+        // Move to the in-order successor.
+        if (((2U * node) + 1U) <= element_count)
+        {
+          node = leftmost((2U * node) + 1U);
+        }
+        else
+        {
+          node >>= etl::countr_one(node) + 1;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return A pointer to the element, or null if the key does not exist.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_pointer find(const key_type& key) const
+    {
+      const size_t node = search(key);
+
+      return ((node != 0U) && !kcompare(key, keys[node])) ? elements[node] : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Finds the first element with a key that is not less than 'key'.
+    ///\param key The key to search for.
+    ///\return A pointer to the element, or null if there is none.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_pointer lower_bound(const key_type& key) const
+    {
+      const size_t node = search(key);
+
+      return (node != 0U) ? elements[node] : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks if the index contains the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const key_type& key) const
+    {
+      return find(key) != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Clears the index.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void clear()
+    {
+      element_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements in the index.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type size() const
+    {
+      return element_count;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements in the index.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type max_size() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// Checks if the index is empty.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool empty() const
+    {
+      return element_count == 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Returns the leftmost descendant of a node.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t leftmost(size_t node) const
+    {
+      while ((2U * node) <= element_count)
+      {
+        node *= 2U;
+      }
+
+      return node;
+    }
+
+    //*************************************************************************
+    /// Returns the node of the first key that is not less than 'key', or 0 if
+    /// there is none.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t search(const key_type& key) const
+    {
+      size_t node = 1U;
+
+      while (node <= element_count)
+      {
+        prefetch(node);
+
+        // Go right if the node's key is less, otherwise left.
+        node = (2U * node) + size_t(kcompare(keys[node], key));
+      }
+
+      // Undo the right turns after the last left turn, and the left turn.
+      node >>= etl::countr_one(node) + 1;
+
+      return node;
+    }
+
+    //*************************************************************************
+    /// Prefetches the keys four levels below a node.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void prefetch(size_t node) const
+    {
+      const size_t descendant = 16U * node;
+
+      if ((descendant <= element_count) && !etl::is_constant_evaluated())
+      {
+        ETL_EYTZINGER_INDEX_PREFETCH(&keys[descendant]);
+      }
+    }
+
+    key_type      keys[VSize + 1U];     ///< The keys in Eytzinger order. The root is at index 1.
+    const_pointer elements[VSize + 1U]; ///< The elements for each key.
+    size_t        element_count;        ///< The number of elements.
+    key_compare   kcompare;             ///< The key comparison.
+  };
+
+  template <typename TKey, typename TMapped, size_t VSize, typename TKeyCompare>
+  ETL_CONSTANT size_t eytzinger_index<TKey, TMapped, VSize, TKeyCompare>::MAX_SIZE;
+} // namespace etl
+
+#endif
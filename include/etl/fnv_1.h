@@ -56,19 +56,19 @@ namespace etl
   {
     typedef uint64_t value_type;
 
-    uint64_t initial() const
+    ETL_CONSTEXPR14 uint64_t initial() const
     {
       return OFFSET_BASIS;
     }
 
-    uint64_t add(uint64_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint64_t add(uint64_t hash, uint8_t value) const
     {
       hash *= PRIME;
       hash ^= value;
       return hash;
     }
 
-    uint64_t final(uint64_t hash) const
+    ETL_CONSTEXPR14 uint64_t final(uint64_t hash) const
     {
       return hash;
     }
@@ -88,7 +88,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    fnv_1_64()
+    ETL_CONSTEXPR14 fnv_1_64()
     {
       this->reset();
     }
@@ -99,7 +99,7 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template <typename TIterator>
-    fnv_1_64(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 fnv_1_64(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
@@ -114,19 +114,19 @@ namespace etl
   {
     typedef uint64_t value_type;
 
-    uint64_t initial() const
+    ETL_CONSTEXPR14 uint64_t initial() const
     {
       return OFFSET_BASIS;
     }
 
-    uint64_t add(uint64_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint64_t add(uint64_t hash, uint8_t value) const
     {
       hash ^= value;
       hash *= PRIME;
       return hash;
     }
 
-    uint64_t final(uint64_t hash) const
+    ETL_CONSTEXPR14 uint64_t final(uint64_t hash) const
     {
       return hash;
     }
@@ -146,7 +146,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    fnv_1a_64()
+    ETL_CONSTEXPR14 fnv_1a_64()
     {
       this->reset();
     }
@@ -157,7 +157,7 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template <typename TIterator>
-    fnv_1a_64(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 fnv_1a_64(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
@@ -173,19 +173,19 @@ namespace etl
   {
     typedef uint32_t value_type;
 
-    uint32_t initial() const
+    ETL_CONSTEXPR14 uint32_t initial() const
     {
       return OFFSET_BASIS;
     }
 
-    uint32_t add(uint32_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint32_t add(uint32_t hash, uint8_t value) const
     {
       hash *= PRIME;
       hash ^= value;
       return hash;
     }
 
-    uint32_t final(uint32_t hash) const
+    ETL_CONSTEXPR14 uint32_t final(uint32_t hash) const
     {
       return hash;
     }
@@ -205,7 +205,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    fnv_1_32()
+    ETL_CONSTEXPR14 fnv_1_32()
     {
       this->reset();
     }
@@ -216,7 +216,7 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template <typename TIterator>
-    fnv_1_32(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 fnv_1_32(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
@@ -231,19 +231,19 @@ namespace etl
   {
     typedef uint32_t value_type;
 
-    uint32_t initial() const
+    ETL_CONSTEXPR14 uint32_t initial() const
     {
       return OFFSET_BASIS;
     }
 
-    uint32_t add(uint32_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint32_t add(uint32_t hash, uint8_t value) const
     {
       hash ^= value;
       hash *= PRIME;
       return hash;
     }
 
-    uint32_t final(uint32_t hash) const
+    ETL_CONSTEXPR14 uint32_t final(uint32_t hash) const
     {
       return hash;
     }
@@ -263,7 +263,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    fnv_1a_32()
+    ETL_CONSTEXPR14 fnv_1a_32()
     {
       this->reset();
     }
@@ -274,7 +274,7 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template <typename TIterator>
-    fnv_1a_32(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 fnv_1a_32(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "static_assert.h"
 #include "type_traits.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 ETL_STATIC_ASSERT(ETL_USING_8BIT_TYPES, "This file does not currently support targets with no 8bit type");
@@ -86,10 +87,41 @@ namespace etl
 
       TFrame_Check_Sequence* p_fcs;
     };
+
+    //***************************************************
+    /// Detects whether a policy has a member function to add a block of
+    /// contiguous bytes.
+    /// value_type add_block(value_type fcs, const uint8_t* p, size_t length) const
+    //***************************************************
+    template <typename TPolicy>
+    struct has_add_block
+    {
+    private:
+
+      typedef typename TPolicy::value_type value_type;
+
+      template <typename U, value_type (U::*)(value_type, const uint8_t*, size_t) const>
+      struct check;
+
+      template <typename U>
+      static char test(check<U, &U::add_block>*);
+
+      template <typename U>
+      static long test(...);
+
+    public:
+
+      static ETL_CONSTANT bool value = (sizeof(test<TPolicy>(0)) == sizeof(char));
+    };
+
+    template <typename TPolicy>
+    ETL_CONSTANT bool has_add_block<TPolicy>::value;
   } // namespace private_frame_check_sequence
 
   //***************************************************************************
   /// Calculates a frame check sequence according to the specified policy.
+  /// If the policy has an 'add_block' member function, then ranges of
+  /// pointers are passed to it as a block, rather than a byte at a time.
   ///\tparam TPolicy The type used to enact the policy.
   ///\ingroup frame_check_sequence
   //***************************************************************************
@@ -146,11 +178,9 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, static_cast<uint8_t>(*begin));
-        ++begin;
-      }
+      typedef etl::integral_constant<bool, etl::is_pointer<TIterator>::value && private_frame_check_sequence::has_add_block<TPolicy>::value> use_block;
+
+      add_range(begin, end, use_block());
     }
 
     //*************************************************************************
@@ -187,6 +217,35 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range a byte at a time.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range of contiguous bytes as a block.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      if (etl::is_constant_evaluated())
+      {
+        add_range(begin, end, etl::false_type());
+      }
+      else
+      {
+        frame_check = policy.add_block(frame_check, reinterpret_cast<const uint8_t*>(begin), static_cast<size_t>(end - begin));
+      }
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
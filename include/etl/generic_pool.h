@@ -64,9 +64,17 @@ namespace etl
     /// Constructor
     //*************************************************************************
     generic_pool()
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+      : etl::ipool(reinterpret_cast<char*>(&buffer[0]), Element_Size, VSize, allocated_bits)
+    {
+      // The bitmap is constructed after the base, so it is cleared here.
+      this->release_all();
+    }
+#else
       : etl::ipool(reinterpret_cast<char*>(&buffer[0]), Element_Size, VSize)
     {
     }
+#endif
 
     //*************************************************************************
     /// Allocate an object from the pool.
@@ -190,6 +198,11 @@ namespace etl
     ///< The memory for the pool of objects.
     typename etl::aligned_storage< sizeof(Element), etl::alignment_of<Element>::value>::type buffer[VSize];
 
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+    ///< One bit per item, set if the item is allocated.
+    ipool::bitmap_word_type allocated_bits[(VSize + ipool::Bitmap_Word_Bits - 1U) / ipool::Bitmap_Word_Bits];
+#endif
+
     static ETL_CONSTANT uint32_t Element_Size = sizeof(Element);
 
     // Should not be copied.
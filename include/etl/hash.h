@@ -41,6 +41,10 @@ SOFTWARE.
   #include "static_assert.h"
   #include "type_traits.h"
 
+  #if defined(ETL_STRING_HASH_USE_WYHASH) && ETL_USING_64BIT_TYPES
+    #include "wyhash.h"
+  #endif
+
   #include <stdint.h>
   #include <stdlib.h>
 
@@ -87,6 +91,35 @@ namespace etl
     }
   #endif
 
+    //*************************************************************************
+    /// Hash to use for strings, string views and other byte sequences.
+    /// Uses etl::wyhash if ETL_STRING_HASH_USE_WYHASH is defined, otherwise
+    /// the generic hash.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    size_t string_hash(const uint8_t* begin, const uint8_t* end)
+    {
+  #if defined(ETL_STRING_HASH_USE_WYHASH) && ETL_USING_64BIT_TYPES
+      uint64_t h = etl::wyhash(begin, end).value();
+
+      // Fold the hash when size_t is smaller.
+      if ETL_IF_CONSTEXPR (sizeof(T) < sizeof(uint64_t))
+      {
+        h ^= (h >> 32U);
+
+        if ETL_IF_CONSTEXPR (sizeof(T) < sizeof(uint32_t))
+        {
+          h ^= (h >> 16U);
+        }
+      }
+
+      return static_cast<size_t>(h);
+  #else
+      return generic_hash<T>(begin, end);
+  #endif
+    }
+
     //*************************************************************************
     /// Primary definition of base hash class, by default is poisoned
     //*************************************************************************
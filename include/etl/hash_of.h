@@ -0,0 +1,72 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HASH_OF_INCLUDED
+#define ETL_HASH_OF_INCLUDED
+
+#include "platform.h"
+
+#include <stddef.h>
+
+///\defgroup hash_of Hash or CRC of text
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup hash_of
+  /// Calculates a hash or CRC of a string literal, excluding the terminating
+  /// null.
+  /// constexpr from C++14 for the CRCs, FNV-1, Jenkins and Murmur3, so the result may
+  /// be used as a constant, such as a case label.
+  /// constexpr auto id = etl::hash_of<etl::crc32_c>("topic/x");
+  ///\tparam THash The hash or CRC type, such as etl::crc32_c or etl::fnv_1a_32.
+  //***************************************************************************
+  template <typename THash, typename TChar, size_t Length>
+  ETL_CONSTEXPR14 typename THash::value_type hash_of(const TChar (&text)[Length])
+  {
+    return THash(text, text + (Length - 1U)).value();
+  }
+
+  //***************************************************************************
+  ///\ingroup hash_of
+  /// Calculates a hash or CRC of text.
+  ///\tparam THash The hash or CRC type, such as etl::crc32_c or etl::fnv_1a_32.
+  ///\param text   The start of the text.
+  ///\param length The length of the text.
+  //***************************************************************************
+  template <typename THash, typename TChar>
+  ETL_CONSTEXPR14 typename THash::value_type hash_of(const TChar* text, size_t length)
+  {
+    return THash(text, text + length).value();
+  }
+} // namespace etl
+
+#endif
@@ -0,0 +1,258 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_QUEUE_MPSC_ATOMIC_INCLUDED
+#define ETL_INTRUSIVE_QUEUE_MPSC_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "error_handler.h"
+#include "intrusive_links.h"
+#include "intrusive_queue.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue
+  /// Base for the lock free intrusive multi-producer, single-consumer queue.
+  /// Stores elements derived from etl::forward_link.
+  /// Producers push on to an atomic LIFO list. When the consumer's FIFO list is
+  /// empty it takes the whole LIFO list in one atomic exchange and reverses it.
+  /// The 'etl_next' link of a value is only written by the producer before the
+  /// value is published, or by the consumer after it has been taken, so the
+  /// links themselves do not need to be atomic.
+  /// \tparam TLink The link type that the value is derived from.
+  //***************************************************************************
+  template <typename TLink>
+  class intrusive_queue_mpsc_atomic_base
+  {
+  public:
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    ETL_STATIC_ASSERT(etl::is_forward_link<link_type>::value, "The link type must be an etl::forward_link");
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// May be called from any thread or interrupt.
+    /// The value is published with a single compare-exchange, which only
+    /// retries if another producer pushed at the same time.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(link_type& value)
+    {
+      ETL_ASSERT_OR_RETURN(!value.is_linked(), ETL_ERROR(intrusive_queue_value_is_already_linked));
+
+      link_type* p_head = p_pushed.load(etl::memory_order_relaxed);
+
+      do
+      {
+        value.etl_next = p_head;
+      } while (!p_pushed.compare_exchange_weak(p_head, &value, etl::memory_order_release, etl::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// Removes the oldest item from the queue.
+    /// Must only be called from the consumer thread.
+    /// Undefined behaviour if the queue is already empty.
+    //*************************************************************************
+    void pop()
+    {
+      link_type* p_value = get_front();
+
+      ETL_ASSERT_CHECK_PUSH_POP_OR_RETURN(p_value != &terminator, ETL_ERROR(intrusive_queue_empty));
+
+      p_front = p_value->etl_next;
+      p_value->clear();
+    }
+
+    //*************************************************************************
+    /// Removes the oldest item from the queue and pushes it to the destination.
+    /// Must only be called from the consumer thread.
+    /// Undefined behaviour if the queue is already empty.
+    /// NOTE: The destination must be an intrusive container that supports a
+    /// push(TLink) member function.
+    //*************************************************************************
+    template <typename TContainer>
+    void pop_into(TContainer& destination)
+    {
+      link_type* p_value = get_front();
+
+      ETL_ASSERT_CHECK_PUSH_POP_OR_RETURN(p_value != &terminator, ETL_ERROR(intrusive_queue_empty));
+
+      pop();
+      destination.push(*p_value);
+    }
+
+    //*************************************************************************
+    /// Clears the queue to the empty state.
+    /// Must only be called from the consumer thread.
+    /// Values pushed concurrently with the clear may remain in the queue.
+    //*************************************************************************
+    void clear()
+    {
+      while (!empty())
+      {
+        pop();
+      }
+    }
+
+    //*************************************************************************
+    /// Checks if the queue is in the empty state.
+    /// Must only be called from the consumer thread.
+    //*************************************************************************
+    bool empty()
+    {
+      return get_front() == &terminator;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    intrusive_queue_mpsc_atomic_base()
+      : p_pushed(&terminator)
+      , p_front(&terminator)
+    {
+      terminator.etl_next = &terminator;
+    }
+
+    //*************************************************************************
+    /// Destructor
+    //*************************************************************************
+    ~intrusive_queue_mpsc_atomic_base() {}
+
+    //*************************************************************************
+    /// Gets the oldest value, taking any pushed values if the front list is
+    /// empty. Returns the terminator if the queue is empty.
+    //*************************************************************************
+    link_type* get_front()
+    {
+      // Only exchange if there is something to take, so that polling an empty
+      // queue does not write to the producers' cache line.
+      if ((p_front == &terminator) && (p_pushed.load(etl::memory_order_relaxed) != &terminator))
+      {
+        take_pushed();
+      }
+
+      return p_front;
+    }
+
+    //*************************************************************************
+    /// Moves the pushed values to the front list, in the order in which they
+    /// were pushed.
+    //*************************************************************************
+    void take_pushed()
+    {
+      link_type* p_value    = p_pushed.exchange(&terminator, etl::memory_order_acquire);
+      link_type* p_reversed = &terminator;
+
+      while (p_value != &terminator)
+      {
+        link_type* p_next = p_value->etl_next;
+        p_value->etl_next = p_reversed;
+        p_reversed        = p_value;
+        p_value           = p_next;
+      }
+
+      p_front = p_reversed;
+    }
+
+    link_type               terminator; ///< This link terminates both lists.
+    etl::atomic<link_type*> p_pushed;   ///< The most recently pushed value.
+    link_type*              p_front;    ///< The oldest value. Only accessed by the consumer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue
+  /// A lock free intrusive multi-producer, single-consumer queue.
+  /// Stores elements derived from etl::forward_link.
+  /// Any number of threads or interrupts may push. Only one thread may call
+  /// front, pop, empty or clear.
+  /// \tparam TValue The type of value that the queue holds.
+  /// \tparam TLink  The link type that the value is derived from.
+  //***************************************************************************
+  template <typename TValue, typename TLink>
+  class intrusive_queue_mpsc_atomic : public etl::intrusive_queue_mpsc_atomic_base<TLink>
+  {
+  public:
+
+    // Node typedef.
+    typedef typename etl::intrusive_queue_mpsc_atomic_base<TLink>::link_type link_type;
+
+    // STL style typedefs.
+    typedef TValue            value_type;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    intrusive_queue_mpsc_atomic()
+      : intrusive_queue_mpsc_atomic_base<TLink>()
+    {
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the value at the front of the queue.
+    /// Must only be called from the consumer thread.
+    /// If asserts or exceptions are enabled, throws an
+    /// etl::intrusive_queue_empty if the queue is empty.
+    /// \return A reference to the value at the front of the queue.
+    //*************************************************************************
+    reference front()
+    {
+      link_type* p_value = this->get_front();
+
+      ETL_ASSERT_CHECK_EXTRA(p_value != &this->terminator, ETL_ERROR(intrusive_queue_empty));
+      return *static_cast<TValue*>(p_value);
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_queue_mpsc_atomic(const intrusive_queue_mpsc_atomic&);
+    intrusive_queue_mpsc_atomic& operator=(const intrusive_queue_mpsc_atomic& rhs);
+  };
+} // namespace etl
+
+#endif
+
+#endif
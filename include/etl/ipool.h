@@ -32,6 +32,7 @@ SOFTWARE.
 #define ETL_IPOOL_INCLUDED
 
 #include "platform.h"
+#include "bit.h"
 #include "error_handler.h"
 #include "exception.h"
 #include "iterator.h"
@@ -136,11 +137,12 @@ namespace etl
 
     //***************************************************************************
     /// Iterate free list to confirm specified address is included or not
+    /// The list ends at the first item that has not been initialised.
     //***************************************************************************
     bool is_in_free_list(const char* address) const
     {
       const char* i = p_next;
-      while (i != ETL_NULLPTR)
+      while ((i != ETL_NULLPTR) && (i < buffer_end()))
       {
         if (address == i)
         {
@@ -151,8 +153,56 @@ namespace etl
       return false;
     }
 
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+    //***************************************************************************
+    /// Does the pool have an allocation bitmap?
+    //***************************************************************************
+    bool has_allocation_bitmap() const
+    {
+      return p_allocated != ETL_NULLPTR;
+    }
+
+    //***************************************************************************
+    /// Finds the first allocated item at or after 'address', using the
+    /// allocation bitmap. Returns buffer_end() if there are none.
+    //***************************************************************************
+    char* find_allocated_in_bitmap(const char* address) const
+    {
+      size_t index = size_t(address - p_buffer) / Item_Size;
+
+      while (index < items_initialised)
+      {
+        // Ignore the bits for the items before 'index' in this word.
+        bitmap_word_type bits = p_allocated[index / Bitmap_Word_Bits] & (~bitmap_word_type(0U) << (index % Bitmap_Word_Bits));
+
+        if (bits != 0U)
+        {
+          index = ((index / Bitmap_Word_Bits) * Bitmap_Word_Bits) + size_t(etl::countr_zero(bits));
+          break;
+        }
+
+        index = ((index / Bitmap_Word_Bits) + 1U) * Bitmap_Word_Bits;
+      }
+
+      if (index > items_initialised)
+      {
+        index = items_initialised;
+      }
+
+      return p_buffer + (index * Item_Size);
+    }
+#endif
+
   public:
 
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+    /// The type of a word in an allocation bitmap.
+    typedef uint32_t bitmap_word_type;
+
+    /// The number of bits in an allocation bitmap word.
+    static ETL_CONSTANT size_t Bitmap_Word_Bits = 32U;
+#endif
+
     //***************************************************************************
     template <bool is_const>
     class ipool_iterator
@@ -236,6 +286,14 @@ namespace etl
       //***************************************************************************
       void find_allocated()
       {
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+        if (p_pool->has_allocation_bitmap())
+        {
+          p_current = p_pool->find_allocated_in_bitmap(p_current);
+          return;
+        }
+#endif
+
         while (p_current < p_pool->buffer_end())
         {
           value_type value = *reinterpret_cast<pointer_type>(p_current);
@@ -472,6 +530,10 @@ namespace etl
       items_allocated   = 0;
       items_initialised = 0;
       p_next            = p_buffer;
+
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+      clear_allocation_bitmap();
+#endif
     }
 
     //*************************************************************************
@@ -485,6 +547,32 @@ namespace etl
       return is_item_in_pool((const char*)p);
     }
 
+    //*************************************************************************
+    /// Check to see if the object is currently allocated from the pool.
+    /// O(1) if the pool has an allocation bitmap, otherwise searches the free
+    /// list.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it is, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_allocated(const void* const p_object) const
+    {
+      const char* p = static_cast<const char*>(p_object);
+
+      if (!is_item_in_pool(p) || (p >= buffer_end()))
+      {
+        return false;
+      }
+
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+      if (has_allocation_bitmap())
+      {
+        return test_allocated_bit(p);
+      }
+#endif
+
+      return !is_in_free_list(p);
+    }
+
     //*************************************************************************
     /// Returns the maximum number of items in the pool.
     //*************************************************************************
@@ -545,6 +633,32 @@ namespace etl
 
   protected:
 
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+    //*************************************************************************
+    /// Constructor
+    /// If 'p_allocated_' is not null, it must point to bitmap_words(max_size_)
+    /// words, which are used to track the allocated items. They are cleared by
+    /// release_all().
+    //*************************************************************************
+    ipool(char* p_buffer_, uint32_t item_size_, uint32_t max_size_, bitmap_word_type* p_allocated_ = ETL_NULLPTR)
+      : p_buffer(p_buffer_)
+      , p_next(p_buffer_)
+      , p_allocated(p_allocated_)
+      , items_allocated(0)
+      , items_initialised(0)
+      , Item_Size(item_size_)
+      , Max_Size(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of allocation bitmap words needed for a pool.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t bitmap_words(size_t max_size_)
+    {
+      return (max_size_ + Bitmap_Word_Bits - 1U) / Bitmap_Word_Bits;
+    }
+#else
     //*************************************************************************
     /// Constructor
     //*************************************************************************
@@ -557,6 +671,7 @@ namespace etl
       , Max_Size(max_size_)
     {
     }
+#endif
 
   private:
 
@@ -600,6 +715,13 @@ namespace etl
         // needs to be different from ETL_NULLPTR since ETL_NULLPTR is used
         // as list endmarker
         *reinterpret_cast<uintptr_t*>(p_value) = invalid_item_ptr;
+
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+        if (has_allocation_bitmap())
+        {
+          flip_allocated_bit(p_value);
+        }
+#endif
       }
       else
       {
@@ -619,6 +741,16 @@ namespace etl
 
       if (items_allocated > 0)
       {
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+        if (has_allocation_bitmap())
+        {
+          // Was it allocated?
+          ETL_ASSERT_OR_RETURN(test_allocated_bit(p_value), ETL_ERROR(pool_object_not_in_pool));
+
+          flip_allocated_bit(p_value);
+        }
+#endif
+
         // Point it to the current free item.
         *(uintptr_t*)p_value = reinterpret_cast<uintptr_t>(p_next);
 
@@ -653,12 +785,48 @@ namespace etl
       return is_within_range && is_valid_address;
     }
 
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+    //*************************************************************************
+    /// Tests the allocation bitmap bit for an item.
+    //*************************************************************************
+    bool test_allocated_bit(const char* p) const
+    {
+      size_t index = size_t(p - p_buffer) / Item_Size;
+
+      return (p_allocated[index / Bitmap_Word_Bits] & (bitmap_word_type(1U) << (index % Bitmap_Word_Bits))) != 0U;
+    }
+
+    //*************************************************************************
+    /// Flips the allocation bitmap bit for an item.
+    //*************************************************************************
+    void flip_allocated_bit(const char* p)
+    {
+      size_t index = size_t(p - p_buffer) / Item_Size;
+
+      p_allocated[index / Bitmap_Word_Bits] ^= (bitmap_word_type(1U) << (index % Bitmap_Word_Bits));
+    }
+
+    //*************************************************************************
+    /// Clears the allocation bitmap, if there is one.
+    //*************************************************************************
+    void clear_allocation_bitmap()
+    {
+      if (has_allocation_bitmap())
+      {
+        etl::fill_n(p_allocated, bitmap_words(Max_Size), bitmap_word_type(0U));
+      }
+    }
+#endif
+
     // Disable copy construction and assignment.
     ipool(const ipool&);
     ipool& operator=(const ipool&);
 
-    char* p_buffer;
-    char* p_next;
+    char*             p_buffer;
+    char*             p_next;
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+    bitmap_word_type* p_allocated; ///< One bit per item, set if allocated, or null if not tracked.
+#endif
 
     uint32_t items_allocated;   ///< The number of items allocated.
     uint32_t items_initialised; ///< The number of items initialised.
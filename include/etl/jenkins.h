@@ -57,16 +57,25 @@ namespace etl
   {
     typedef uint32_t value_type;
 
-    uint32_t initial() const
+    ETL_CONSTEXPR14 jenkins_policy()
+      : is_finalised(false)
+    {
+    }
+
+    ETL_CONSTEXPR14 uint32_t initial() const
     {
       is_finalised = false;
 
       return 0;
     }
 
-    uint32_t add(value_type hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint32_t add(value_type hash, uint8_t value) const
     {
-      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+      // A mutable member cannot be read in a constant expression.
+      if (!etl::is_constant_evaluated())
+      {
+        ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+      }
 
       hash += value;
       hash += (hash << 10U);
@@ -75,7 +84,7 @@ namespace etl
       return hash;
     }
 
-    uint32_t final(value_type hash) const
+    ETL_CONSTEXPR14 uint32_t final(value_type hash) const
     {
       hash += (hash << 3U);
       hash ^= (hash >> 11U);
@@ -98,7 +107,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    jenkins()
+    ETL_CONSTEXPR14 jenkins()
     {
       this->reset();
     }
@@ -109,7 +118,7 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template <typename TIterator>
-    jenkins(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 jenkins(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
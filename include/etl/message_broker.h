@@ -35,11 +35,20 @@ SOFTWARE.
 #include "message_types.h"
 #include "nullptr.h"
 #include "span.h"
+#include "static_assert.h"
+
+#include <stddef.h>
 
 namespace etl
 {
+  template <size_t Max_Index_Size>
+  class message_broker_indexed;
+
   //***************************************************************************
   /// Message broker
+  /// Each message is checked against the message id list of every
+  /// subscription. See etl::message_broker_indexed for a broker that looks up
+  /// the subscriptions for a message id in an index.
   //***************************************************************************
   class message_broker : public etl::imessage_router
   {
@@ -100,6 +109,9 @@ namespace etl
 
       friend class message_broker;
 
+      template <size_t Max_Index_Size>
+      friend class message_broker_indexed;
+
       //*******************************
       subscription(etl::imessage_router& router_)
         : p_router(&router_)
@@ -174,12 +186,14 @@ namespace etl
     void subscribe(etl::message_broker::subscription& new_sub)
     {
       initialise_insertion_point(new_sub.get_router(), &new_sub);
+      on_subscriptions_changed();
     }
 
     //*******************************************
     void unsubscribe(etl::imessage_router& router)
     {
       initialise_insertion_point(&router, ETL_NULLPTR);
+      on_subscriptions_changed();
     }
 
     //*******************************************
@@ -318,6 +332,7 @@ namespace etl
     void clear()
     {
       head.terminate();
+      on_subscriptions_changed();
     }
 
     //********************************************
@@ -345,6 +360,19 @@ namespace etl
       return head.get_next() == ETL_NULLPTR;
     }
 
+  protected:
+
+    //********************************************
+    subscription* first_subscription() const
+    {
+      return static_cast<subscription*>(head.get_next());
+    }
+
+    //********************************************
+    /// Called at the end of subscribe, unsubscribe and clear.
+    //********************************************
+    virtual void on_subscriptions_changed() {}
+
   private:
 
     //*******************************************
@@ -382,6 +410,329 @@ namespace etl
 
     subscription_node head;
   };
+
+  //***************************************************************************
+  /// Message broker with an index from message id to subscribed router.
+  /// A message is only checked against the routers that subscribed to its id,
+  /// rather than against every subscription.
+  /// The index is rebuilt by subscribe, unsubscribe and clear.
+  /// A subscription's message id list must not change while it is subscribed.
+  /// If the subscriptions list more than Max_Index_Size message ids in total,
+  /// the broker scans the subscriptions instead, until there are fewer.
+  ///\tparam Max_Index_Size The maximum number of subscription message ids.
+  //***************************************************************************
+  template <size_t Max_Index_Size>
+  class message_broker_indexed : public etl::message_broker
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Index_Size > 0U, "Index size must be greater than zero");
+
+    static ETL_CONSTANT size_t MAX_INDEX_SIZE = Max_Index_Size;
+
+    using etl::message_broker::receive;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed()
+      : message_broker()
+      , index_size(0U)
+      , index_valid(true)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed(etl::imessage_router& successor_)
+      : message_broker(successor_)
+      , index_size(0U)
+      , index_valid(true)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed(etl::message_router_id_t id_)
+      : message_broker(id_)
+      , index_size(0U)
+      , index_valid(true)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : message_broker(id_, successor_)
+      , index_size(0U)
+      , index_valid(true)
+    {
+    }
+
+    //*******************************************
+    virtual void receive(const etl::imessage& msg) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, msg);
+    }
+
+    virtual void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
+    }
+
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id, const etl::imessage& msg) ETL_OVERRIDE
+    {
+      if (!index_valid)
+      {
+        message_broker::receive(destination_router_id, msg);
+        return;
+      }
+
+      const etl::message_id_t id = msg.get_message_id();
+
+      const index_entry*    p_entry = index_buffer + find_index_position(id);
+      etl::imessage_router* router  = next_router(p_entry, id, destination_router_id);
+
+      while (router != ETL_NULLPTR)
+      {
+        router->receive(msg);
+        router = next_router(p_entry, id, destination_router_id);
+      }
+
+      // Always pass the message on to the successor.
+      if (has_successor())
+      {
+        get_successor().receive(destination_router_id, msg);
+      }
+    }
+
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id, etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      if (!index_valid)
+      {
+        message_broker::receive(destination_router_id, shared_msg);
+        return;
+      }
+
+      const etl::message_id_t id = shared_msg.get_message().get_message_id();
+
+      const index_entry*    p_entry = index_buffer + find_index_position(id);
+      etl::imessage_router* router  = next_router(p_entry, id, destination_router_id);
+
+      while (router != ETL_NULLPTR)
+      {
+        router->receive(shared_msg);
+        router = next_router(p_entry, id, destination_router_id);
+      }
+
+      // Always pass the message on to a successor.
+      if (has_successor())
+      {
+        get_successor().receive(destination_router_id, shared_msg);
+      }
+    }
+
+    using etl::message_broker::accepts;
+
+    //*******************************************
+    /// Message brokers accept messages determined
+    /// by the subscribed routers.
+    //*******************************************
+    virtual bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      if (!index_valid)
+      {
+        return message_broker::accepts(id);
+      }
+
+      const index_entry*    p_entry = index_buffer + find_index_position(id);
+      etl::imessage_router* router  = next_router(p_entry, id, etl::imessage_router::ALL_MESSAGE_ROUTERS);
+
+      while (router != ETL_NULLPTR)
+      {
+        if (router->accepts(id))
+        {
+          return true;
+        }
+
+        router = next_router(p_entry, id, etl::imessage_router::ALL_MESSAGE_ROUTERS);
+      }
+
+      // Check any successor.
+      if (has_successor())
+      {
+        if (get_successor().accepts(id))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //********************************************
+    /// Returns true if messages are routed using the index.
+    /// This is false if the subscriptions need more index entries than
+    /// Max_Index_Size.
+    //********************************************
+    bool is_indexed() const
+    {
+      return index_valid;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Rebuilds the index when the subscriptions change.
+    //*******************************************
+    virtual void on_subscriptions_changed() ETL_OVERRIDE
+    {
+      rebuild_index();
+    }
+
+  private:
+
+    //*******************************************
+    /// An entry in the index.
+    //*******************************************
+    struct index_entry
+    {
+      etl::message_id_t     id;
+      etl::imessage_router* p_router;
+    };
+
+    //*******************************************
+    /// Rebuilds the index from the subscriptions.
+    /// The entries are sorted by message id. Entries with the same id are in
+    /// subscription order, so messages are sent to the routers in the same
+    /// order as when the subscriptions are scanned.
+    //*******************************************
+    void rebuild_index()
+    {
+      index_size  = 0U;
+      index_valid = true;
+
+      subscription* sub = first_subscription();
+
+      while (index_valid && (sub != ETL_NULLPTR))
+      {
+        message_id_span_t message_ids = sub->message_id_list();
+
+        for (message_id_span_t::iterator itr = message_ids.begin(); index_valid && (itr != message_ids.end()); ++itr)
+        {
+          index_valid = add_index_entry(*itr, sub->get_router());
+        }
+
+        sub = sub->next_subscription();
+      }
+
+      if (!index_valid)
+      {
+        index_size = 0U;
+      }
+    }
+
+    //*******************************************
+    /// Adds an entry after any others for the same message id.
+    /// Returns false if the index is full.
+    //*******************************************
+    bool add_index_entry(etl::message_id_t id, etl::imessage_router* p_router)
+    {
+      // Find the end of the entries for the id.
+      index_entry* p_entry = index_buffer + find_index_position(id);
+      index_entry* p_end   = index_buffer + index_size;
+
+      while ((p_entry != p_end) && (p_entry->id == id))
+      {
+        // Ignore a message id that is listed twice.
+        if (p_entry->p_router == p_router)
+        {
+          return true;
+        }
+
+        ++p_entry;
+      }
+
+      if (index_size == Max_Index_Size)
+      {
+        return false;
+      }
+
+      // Make room for the new entry.
+      for (index_entry* p_move = p_end; p_move != p_entry; --p_move)
+      {
+        *p_move = *(p_move - 1);
+      }
+
+      p_entry->id       = id;
+      p_entry->p_router = p_router;
+      ++index_size;
+
+      return true;
+    }
+
+    //*******************************************
+    /// Returns the position of the first entry for the message id, or of the
+    /// entry that it would be inserted before.
+    //*******************************************
+    size_t find_index_position(etl::message_id_t id) const
+    {
+      size_t first = 0U;
+      size_t count = index_size;
+
+      while (count > 0U)
+      {
+        const size_t step = count / 2U;
+
+        if (index_buffer[first + step].id < id)
+        {
+          first += step + 1U;
+          count -= step + 1U;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+    //*******************************************
+    /// Returns the router of the next entry for the message id that matches
+    /// the destination, and moves 'p_entry' past it.
+    /// Returns ETL_NULLPTR if there are no more.
+    //*******************************************
+    etl::imessage_router* next_router(const index_entry*& p_entry, etl::message_id_t id, etl::message_router_id_t destination_router_id) const
+    {
+      const index_entry* const p_end = index_buffer + index_size;
+
+      while ((p_entry != p_end) && (p_entry->id == id))
+      {
+        etl::imessage_router* router = p_entry->p_router;
+        ++p_entry;
+
+        if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS || destination_router_id == router->get_message_router_id())
+        {
+          return router;
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    index_entry index_buffer[Max_Index_Size]; ///< The index, sorted by message id.
+    size_t      index_size;                   ///< The number of entries in the index.
+    bool        index_valid;                  ///< True if the index holds every subscribed message id.
+  };
+
+  template <size_t Max_Index_Size>
+  ETL_CONSTANT size_t message_broker_indexed<Max_Index_Size>::MAX_INDEX_SIZE;
 } // namespace etl
 
 #endif
@@ -38,12 +38,23 @@ SOFTWARE.
 #include "message.h"
 #include "message_packet.h"
 #include "message_types.h"
+#include "power.h"
 #include "shared_message.h"
+#include "smallest.h"
 #include "successor.h"
 #include "type_list.h"
 #include "type_traits.h"
 
 #include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+/// A router whose message ids are not contiguous finds the handler through a
+/// table indexed by message id, if the range of ids is no larger than this.
+//*****************************************************************************
+#if !defined(ETL_MESSAGE_ROUTER_MAX_DENSE_ID_RANGE)
+  #define ETL_MESSAGE_ROUTER_MAX_DENSE_ID_RANGE 256
+#endif
 
 namespace etl
 {
@@ -125,6 +136,190 @@ namespace etl
     {
     };
 #endif
+
+#if ETL_USING_CPP14
+    //***************************************************************************
+    // A perfect hash of a set of message ids, built at compile time.
+    // The ids are divided into buckets by the upper bits of a hash. Each
+    // bucket, largest first, is given a displacement that moves all of its
+    // ids to free slots when XORed with the lower bits of the hash.
+    // The slot table holds the index of each id. An unknown id also maps to
+    // a slot, so the id at the index must be checked.
+    // 'valid' is false if no perfect hash was found.
+    //***************************************************************************
+    template <size_t Number_Of_Ids>
+    struct perfect_hash
+    {
+      static constexpr size_t Slots   = etl::power_of_2_round_up<2U * Number_Of_Ids>::value;
+      static constexpr size_t Buckets = etl::power_of_2_round_up<(Number_Of_Ids / 2U) + 1U>::value;
+
+      typedef typename etl::smallest_uint_for_value<Slots>::type         displacement_type;
+      typedef typename etl::smallest_uint_for_value<Number_Of_Ids>::type index_type;
+
+      //*************************************************************************
+      constexpr perfect_hash()
+        : seed(0U)
+        , displacement()
+        , slot_index()
+        , valid(false)
+      {
+      }
+
+      //*************************************************************************
+      // Builds the hash for the ids, trying a number of seeds.
+      //*************************************************************************
+      constexpr void build(const etl::message_id_t* ids)
+      {
+        for (uint32_t s = 0U; !valid && (s < 16U); ++s)
+        {
+          valid = try_seed(ids, s * 0x9E3779B9UL);
+        }
+      }
+
+      //*************************************************************************
+      // Returns the index of the id, or of the id that shares its slot, or
+      // Number_Of_Ids if the slot is empty.
+      //*************************************************************************
+      constexpr size_t find(etl::message_id_t id) const
+      {
+        const uint32_t h = hash(id, seed);
+
+        return slot_index[(h ^ displacement[bucket_of(h)]) % Slots];
+      }
+
+      uint32_t          seed;
+      displacement_type displacement[Buckets];
+      index_type        slot_index[Slots];
+      bool              valid;
+
+    private:
+
+      //*************************************************************************
+      static constexpr uint32_t hash(etl::message_id_t id, uint32_t seed_)
+      {
+        uint32_t h = static_cast<uint32_t>(id) ^ seed_;
+
+        h ^= h >> 16U;
+        h *= 0x85EBCA6BUL;
+        h ^= h >> 13U;
+        h *= 0xC2B2AE35UL;
+        h ^= h >> 16U;
+
+        return h;
+      }
+
+      //*************************************************************************
+      static constexpr size_t bucket_of(uint32_t h)
+      {
+        return (h >> 16U) % Buckets;
+      }
+
+      //*************************************************************************
+      constexpr bool try_seed(const etl::message_id_t* ids, uint32_t seed_)
+      {
+        seed = seed_;
+
+        for (size_t i = 0U; i < Slots; ++i)
+        {
+          slot_index[i] = static_cast<index_type>(Number_Of_Ids);
+        }
+
+        // Sort the ids by bucket.
+        size_t bucket_start[Buckets + 1U] = {};
+        size_t order[Number_Of_Ids]       = {};
+        size_t largest                    = 0U;
+
+        for (size_t i = 0U; i < Number_Of_Ids; ++i)
+        {
+          ++bucket_start[bucket_of(hash(ids[i], seed)) + 1U];
+        }
+
+        for (size_t b = 0U; b < Buckets; ++b)
+        {
+          largest = (bucket_start[b + 1U] > largest) ? bucket_start[b + 1U] : largest;
+          bucket_start[b + 1U] += bucket_start[b];
+        }
+
+        size_t next[Buckets] = {};
+
+        for (size_t i = 0U; i < Number_Of_Ids; ++i)
+        {
+          const size_t b = bucket_of(hash(ids[i], seed));
+
+          order[bucket_start[b] + next[b]++] = i;
+        }
+
+        // Place the largest buckets first, while there are most free slots.
+        for (size_t size = largest; size > 0U; --size)
+        {
+          for (size_t b = 0U; b < Buckets; ++b)
+          {
+            if ((bucket_start[b + 1U] - bucket_start[b]) == size)
+            {
+              if (!place_bucket(ids, order + bucket_start[b], size, b))
+              {
+                return false;
+              }
+            }
+          }
+        }
+
+        return true;
+      }
+
+      //*************************************************************************
+      // Finds a displacement that moves all of the bucket's ids to free slots.
+      //*************************************************************************
+      constexpr bool place_bucket(const etl::message_id_t* ids, const size_t* members, size_t size, size_t bucket)
+      {
+        for (size_t d = 0U; d < Slots; ++d)
+        {
+          size_t placed = 0U;
+
+          while (placed < size)
+          {
+            const size_t slot = (hash(ids[members[placed]], seed) ^ d) % Slots;
+
+            if (slot_index[slot] != Number_Of_Ids)
+            {
+              break;
+            }
+
+            slot_index[slot] = static_cast<index_type>(members[placed]);
+            ++placed;
+          }
+
+          if (placed == size)
+          {
+            displacement[bucket] = static_cast<displacement_type>(d);
+            return true;
+          }
+
+          // Undo the partial placement.
+          while (placed > 0U)
+          {
+            --placed;
+            slot_index[(hash(ids[members[placed]], seed) ^ d) % Slots] = static_cast<index_type>(Number_Of_Ids);
+          }
+        }
+
+        return false;
+      }
+    };
+
+    //***************************************************************************
+    // Makes a perfect hash for the ids.
+    //***************************************************************************
+    template <size_t Number_Of_Ids>
+    constexpr perfect_hash<Number_Of_Ids> make_perfect_hash(const etl::array<etl::message_id_t, Number_Of_Ids>& ids)
+    {
+      perfect_hash<Number_Of_Ids> table;
+
+      table.build(ids.data());
+
+      return table;
+    }
+#endif
   } // namespace private_message_router
 
   //***************************************************************************
@@ -629,6 +824,31 @@ namespace etl
     // each message id is one greater than the previous message id.
     static constexpr bool Message_Ids_Are_Contiguous = (Number_Of_Messages <= 1U) ? true : contiguous_impl<0U>::value;
 
+    static constexpr etl::message_id_t Message_Id_Last = etl::type_list_type_at_index_t<sorted_message_types, Number_Of_Messages - 1U>::ID;
+    static constexpr size_t            Message_Id_Range = static_cast<size_t>(Message_Id_Last - Message_Id_Start) + 1U;
+
+    //**********************************************
+    // The ways of finding the dispatch index for a message id.
+    //**********************************************
+    enum
+    {
+      Direct_Index,  ///< The ids are contiguous. The index is the offset from the first id.
+      Dense_Table,   ///< A table indexed by the offset from the first id.
+      Perfect_Hash,  ///< A perfect hash of the ids.
+      Binary_Search, ///< A binary search of the sorted ids.
+    };
+
+    static constexpr int Dispatch_Method = Message_Ids_Are_Contiguous                                      ? Direct_Index
+                                           : (Message_Id_Range <= ETL_MESSAGE_ROUTER_MAX_DENSE_ID_RANGE) ? Dense_Table
+  #if ETL_USING_CPP14
+                                                                                                         : Perfect_Hash;
+  #else
+                                                                                                         : Binary_Search;
+  #endif
+
+    /// The index type for the dispatch index tables. Number_Of_Messages marks an unknown id.
+    using index_t = typename etl::smallest_uint_for_value<Number_Of_Messages>::type;
+
     using handler_ptr = void (*)(TDerived&,
                                  const etl::imessage&); ///< Pointer to a handler function that
                                                         ///< takes a reference to the derived
@@ -641,6 +861,10 @@ namespace etl
                                           Number_Of_Messages>; ///< The message id table type. An
                                                                ///< array of message ids, one for
                                                                ///< each message type.
+    using dense_index_table_t = etl::array<index_t,
+                                           Message_Id_Range>; ///< The dense index table type. An
+                                                              ///< array of dispatch indexes, one
+                                                              ///< for each message id in the range.
 
     //**********************************************
     // Call for a single message type
@@ -694,48 +918,113 @@ namespace etl
     }
 
     //**********************************************
-    // Get the dispatch index for a message id.
+    // Get the dispatch index for a message id, which must not be less than the
+    // first message id.
     // This will be used at runtime to find the handler for a message id.
-    // If the message ids are contiguous, we can calculate the index directly.
-    // If they are not contiguous, we need to do a binary search. This will
-    // return Number_Of_Messages if the message id is not found, which indicates
-    // that the message should be passed to the successor.
+    // This will return Number_Of_Messages if the message id is not found,
+    // which indicates that the message should be passed to the successor.
     //**********************************************
     static size_t get_dispatch_index_from_message_id(etl::message_id_t id)
     {
-      if ETL_IF_CONSTEXPR (Message_Ids_Are_Contiguous)
+      return get_dispatch_index(id, etl::integral_constant<int, Dispatch_Method>());
+    }
+
+    //**********************************************
+    // The IDs are contiguous, so we can calculate the index directly.
+    //**********************************************
+    static size_t get_dispatch_index(etl::message_id_t id, etl::integral_constant<int, Direct_Index>)
+    {
+      return static_cast<size_t>(id - Message_Id_Start);
+    }
+
+    //**********************************************
+    // The range of IDs is small, so we can look up the index in a table
+    // with an entry for each id in the range.
+    //**********************************************
+    static size_t get_dispatch_index(etl::message_id_t id, etl::integral_constant<int, Dense_Table>)
+    {
+      static constexpr dense_index_table_t dense_index_table = make_dense_index_table(etl::make_index_sequence<Message_Id_Range>{});
+
+      const size_t offset = static_cast<size_t>(id - Message_Id_Start);
+
+      return (offset < Message_Id_Range) ? dense_index_table[offset] : Number_Of_Messages;
+    }
+
+  #if ETL_USING_CPP14
+    //**********************************************
+    // The range of IDs is large, so we look up the index with a perfect hash,
+    // and check that the id at the index matches.
+    //**********************************************
+    static size_t get_dispatch_index(etl::message_id_t id, etl::integral_constant<int, Perfect_Hash>)
+    {
+      static constexpr private_message_router::perfect_hash<Number_Of_Messages> hash_table =
+        private_message_router::make_perfect_hash(message_id_table);
+
+      if ETL_IF_CONSTEXPR (hash_table.valid)
       {
-        // The IDs are contiguous, so we can calculate the index directly.
-        return static_cast<size_t>(id - Message_Id_Start);
+        const size_t index = hash_table.find(id);
+
+        return ((index < Number_Of_Messages) && (message_id_table[index] == id)) ? index : Number_Of_Messages;
       }
       else
       {
-        // The IDs are not contiguous, so we need to do a binary search.
-        size_t left  = 0;
-        size_t right = Number_Of_Messages;
+        return get_dispatch_index(id, etl::integral_constant<int, Binary_Search>());
+      }
+    }
+  #endif
 
-        while (left < right)
-        {
-          size_t mid = (left + right) / 2;
+    //**********************************************
+    // The IDs are not contiguous, so we need to do a binary search.
+    //**********************************************
+    static size_t get_dispatch_index(etl::message_id_t id, etl::integral_constant<int, Binary_Search>)
+    {
+      size_t left  = 0;
+      size_t right = Number_Of_Messages;
 
-          if (message_id_table[mid] == id)
-          {
-            return mid;
-          }
-          else if (message_id_table[mid] < id)
-          {
-            left = mid + 1;
-          }
-          else
-          {
-            right = mid;
-          }
+      while (left < right)
+      {
+        size_t mid = (left + right) / 2;
+
+        if (message_id_table[mid] == id)
+        {
+          return mid;
+        }
+        else if (message_id_table[mid] < id)
+        {
+          left = mid + 1;
+        }
+        else
+        {
+          right = mid;
         }
       }
 
       return Number_Of_Messages; // Not found
     }
 
+    //**********************************************
+    // Find the index of a message id in the sorted message id table at
+    // compile time, or Number_Of_Messages if it is not there.
+    //**********************************************
+    static constexpr index_t find_message_id_index(etl::message_id_t id, size_t left, size_t right)
+    {
+      return (left >= right)                                          ? static_cast<index_t>(Number_Of_Messages)
+             : (message_id_table[(left + right) / 2U] == id)          ? static_cast<index_t>((left + right) / 2U)
+             : (message_id_table[(left + right) / 2U] < id)           ? find_message_id_index(id, ((left + right) / 2U) + 1U, right)
+                                                                      : find_message_id_index(id, left, (left + right) / 2U);
+    }
+
+    //**********************************************
+    // Generate the dense index table at compile time.
+    // This will create an array of dispatch indexes, one for each message id
+    // in the range.
+    //**********************************************
+    template <size_t... Offsets>
+    static constexpr dense_index_table_t make_dense_index_table(etl::index_sequence<Offsets...>)
+    {
+      return dense_index_table_t{{find_message_id_index(static_cast<etl::message_id_t>(Message_Id_Start + Offsets), 0U, Number_Of_Messages)...}};
+    }
+
     //**********************************************
     // Dispatch the message to the appropriate handler based on the index in the
     // dispatch table.
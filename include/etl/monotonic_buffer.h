@@ -0,0 +1,298 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MONOTONIC_BUFFER_INCLUDED
+#define ETL_MONOTONIC_BUFFER_INCLUDED
+
+#include "platform.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "imemory_block_allocator.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for a monotonic_buffer.
+  //***************************************************************************
+  class monotonic_buffer_exception : public etl::exception
+  {
+  public:
+
+    monotonic_buffer_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for rewinding to a mark that is after the current position.
+  //***************************************************************************
+  class monotonic_buffer_invalid_mark : public etl::monotonic_buffer_exception
+  {
+  public:
+
+    monotonic_buffer_invalid_mark(string_type file_name_, numeric_type line_number_)
+      : monotonic_buffer_exception(ETL_ERROR_TEXT("monotonic_buffer:mark", ETL_MONOTONIC_BUFFER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A monotonic buffer, or arena, over a caller supplied buffer.
+  /// Allocation advances a position through the buffer, so costs little more
+  /// than aligning a pointer. Individual blocks are not freed, except for the
+  /// most recent one. Instead, the position is returned to an earlier mark with
+  /// rewind(), or to the start with reset().
+  /// Destructors are not called for anything constructed in the buffer.
+  //***************************************************************************
+  class monotonic_buffer : public imemory_block_allocator
+  {
+  public:
+
+    /// A position in the buffer.
+    typedef size_t mark_type;
+
+    //*************************************************************************
+    /// Rewinds the buffer to the position at construction when it goes out of
+    /// scope. Scopes may be nested.
+    //*************************************************************************
+    class scope
+    {
+    public:
+
+      //***********************************************************************
+      /// Constructor. Marks the current position.
+      //***********************************************************************
+      explicit scope(monotonic_buffer& buffer_)
+        : buffer(buffer_)
+        , position(buffer_.mark())
+      {
+      }
+
+      //***********************************************************************
+      /// Destructor. Rewinds to the marked position.
+      //***********************************************************************
+      ~scope()
+      {
+        buffer.rewind(position);
+      }
+
+    private:
+
+      scope(const scope&) ETL_DELETE;
+      scope& operator=(const scope&) ETL_DELETE;
+
+      monotonic_buffer& buffer;
+      const mark_type   position;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer_ The buffer to allocate from.
+    ///\param size_   The size of the buffer in bytes.
+    //*************************************************************************
+    monotonic_buffer(void* buffer_, size_t size_)
+      : p_buffer(static_cast<char*>(buffer_))
+      , Capacity(size_)
+      , position(0U)
+      , last_position(0U)
+      , high_water_mark(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Allocates uninitialised storage for 'n' objects of type T.
+    /// The result may be passed to the _ext containers, such as etl::vector_ext.
+    ///\return A pointer to the storage, or null if there is not enough space.
+    //*************************************************************************
+    template <typename T>
+    T* allocate_storage(size_t n = 1U)
+    {
+      if (n > (Capacity / sizeof(T)))
+      {
+        return ETL_NULLPTR;
+      }
+
+      return static_cast<T*>(allocate_block(n * sizeof(T), etl::alignment_of<T>::value));
+    }
+
+    //*************************************************************************
+    /// Returns the current position, to be passed to rewind().
+    //*************************************************************************
+    mark_type mark() const
+    {
+      return position;
+    }
+
+    //*************************************************************************
+    /// Returns to a position previously returned by mark().
+    /// Everything allocated since the mark is discarded.
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::monotonic_buffer_invalid_mark if the mark is after the current
+    /// position.
+    //*************************************************************************
+    void rewind(mark_type position_)
+    {
+      ETL_ASSERT_OR_RETURN(position_ <= position, ETL_ERROR(monotonic_buffer_invalid_mark));
+
+      position      = position_;
+      last_position = position_;
+    }
+
+    //*************************************************************************
+    /// Discards everything allocated.
+    //*************************************************************************
+    void reset()
+    {
+      position      = 0U;
+      last_position = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes used, including alignment padding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return position;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the buffer.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Capacity;
+    }
+
+    //*************************************************************************
+    /// Returns the number of unused bytes.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Capacity - position;
+    }
+
+    //*************************************************************************
+    /// Returns true if nothing is allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return position == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the highest number of bytes that have been used.
+    //*************************************************************************
+    size_t max_usage() const
+    {
+      return high_water_mark;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      // The alignment is a power of two.
+      const uintptr_t address = reinterpret_cast<uintptr_t>(p_buffer + position);
+      const uintptr_t mask    = uintptr_t(required_alignment == 0U ? 0U : required_alignment - 1U);
+      const size_t    start   = position + size_t(((address + mask) & ~mask) - address);
+
+      if ((start > Capacity) || (required_size > (Capacity - start)))
+      {
+        return ETL_NULLPTR;
+      }
+
+      last_position = position;
+      position      = start + required_size;
+
+      if (position > high_water_mark)
+      {
+        high_water_mark = position;
+      }
+
+      return p_buffer + start;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    /// Only the most recent block is actually freed. Other blocks are freed by
+    /// rewind() or reset().
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      if (!is_owner_of_block(pblock))
+      {
+        return false;
+      }
+
+      const size_t offset = size_t(static_cast<const char*>(pblock) - p_buffer);
+
+      // Is it the most recent block?
+      if ((offset >= last_position) && (offset < position))
+      {
+        position = last_position;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      const char* p = static_cast<const char*>(pblock);
+
+      return (p >= p_buffer) && (p < (p_buffer + Capacity));
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    monotonic_buffer(const monotonic_buffer&) ETL_DELETE;
+    monotonic_buffer& operator=(const monotonic_buffer&) ETL_DELETE;
+
+    char* const  p_buffer;        ///< The start of the buffer.
+    const size_t Capacity;        ///< The size of the buffer.
+    size_t       position;        ///< The offset of the first free byte.
+    size_t       last_position;   ///< The position before the most recent allocation.
+    size_t       high_water_mark; ///< The highest position reached.
+  };
+} // namespace etl
+
+#endif
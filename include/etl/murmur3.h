@@ -70,8 +70,13 @@ namespace etl
     /// Default constructor.
     /// \param seed The seed value. Default = 0.
     //*************************************************************************
-    murmur3(value_type seed_ = 0)
-      : seed(seed_)
+    ETL_CONSTEXPR14 murmur3(value_type seed_ = 0)
+      : is_finalised(false)
+      , block_fill_count(0)
+      , char_count(0)
+      , block(0)
+      , hash(seed_)
+      , seed(seed_)
     {
       reset();
     }
@@ -83,8 +88,13 @@ namespace etl
     /// \param seed  The seed value. Default = 0.
     //*************************************************************************
     template <typename TIterator>
-    murmur3(TIterator begin, const TIterator end, value_type seed_ = 0)
-      : seed(seed_)
+    ETL_CONSTEXPR14 murmur3(TIterator begin, const TIterator end, value_type seed_ = 0)
+      : is_finalised(false)
+      , block_fill_count(0)
+      , char_count(0)
+      , block(0)
+      , hash(seed_)
+      , seed(seed_)
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
@@ -108,7 +118,7 @@ namespace etl
     //*************************************************************************
     /// Resets the hash to the initial state.
     //*************************************************************************
-    void reset()
+    ETL_CONSTEXPR14 void reset()
     {
       hash             = seed;
       char_count       = 0;
@@ -123,7 +133,7 @@ namespace etl
     /// \param end
     //*************************************************************************
     template <typename TIterator>
-    void add(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 void add(TIterator begin, const TIterator end)
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
@@ -149,7 +159,7 @@ namespace etl
     /// If the hash has already been finalised then a 'hash_finalised' error
     /// will be emitted. \param value The char to add to the hash.
     //*************************************************************************
-    void add(uint8_t value_)
+    ETL_CONSTEXPR14 void add(uint8_t value_)
     {
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
@@ -169,7 +179,7 @@ namespace etl
     //*************************************************************************
     /// Gets the hash value.
     //*************************************************************************
-    value_type value()
+    ETL_CONSTEXPR14 value_type value()
     {
       finalise();
       return hash;
@@ -178,7 +188,7 @@ namespace etl
     //*************************************************************************
     /// Conversion operator to value_type.
     //*************************************************************************
-    operator value_type()
+    ETL_CONSTEXPR14 operator value_type()
     {
       return value();
     }
@@ -188,7 +198,7 @@ namespace etl
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
-    void add_block()
+    ETL_CONSTEXPR14 void add_block()
     {
       block *= CONSTANT1;
       block = rotate_left(block, SHIFT1);
@@ -202,7 +212,7 @@ namespace etl
     //*************************************************************************
     /// Finalises the hash.
     //*************************************************************************
-    void finalise()
+    ETL_CONSTEXPR14 void finalise()
     {
       if (!is_finalised)
       {
@@ -198,6 +198,50 @@ SOFTWARE.
 // in etl_profile.h
 #include "profiles/determine_development_os.h"
 
+//*************************************
+// Instruction set extensions that the compiler is targeting.
+// Define ETL_NO_SIMD to use the portable code for all of them.
+// MSVC does not define the SSE feature macros, so __AVX__ is used instead.
+#if !defined(ETL_NO_SIMD) && (defined(__SSSE3__) || (defined(ETL_COMPILER_MICROSOFT) && defined(__AVX__)))
+  #define ETL_USING_SSSE3     1
+  #define ETL_NOT_USING_SSSE3 0
+#else
+  #define ETL_USING_SSSE3     0
+  #define ETL_NOT_USING_SSSE3 1
+#endif
+
+#if !defined(ETL_NO_SIMD) && (defined(__SSE4_2__) || (defined(ETL_COMPILER_MICROSOFT) && defined(__AVX__)))
+  #define ETL_USING_SSE42     1
+  #define ETL_NOT_USING_SSE42 0
+#else
+  #define ETL_USING_SSE42     0
+  #define ETL_NOT_USING_SSE42 1
+#endif
+
+#if !defined(ETL_NO_SIMD) && (defined(__PCLMUL__) || (defined(ETL_COMPILER_MICROSOFT) && defined(__AVX__)))
+  #define ETL_USING_PCLMUL     1
+  #define ETL_NOT_USING_PCLMUL 0
+#else
+  #define ETL_USING_PCLMUL     0
+  #define ETL_NOT_USING_PCLMUL 1
+#endif
+
+#if !defined(ETL_NO_SIMD) && defined(__ARM_FEATURE_CRC32)
+  #define ETL_USING_ARM_CRC32     1
+  #define ETL_NOT_USING_ARM_CRC32 0
+#else
+  #define ETL_USING_ARM_CRC32     0
+  #define ETL_NOT_USING_ARM_CRC32 1
+#endif
+
+#if !defined(ETL_NO_SIMD) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+  #define ETL_USING_ARM_PMULL     1
+  #define ETL_NOT_USING_ARM_PMULL 0
+#else
+  #define ETL_USING_ARM_PMULL     0
+  #define ETL_NOT_USING_ARM_PMULL 1
+#endif
+
 //*************************************
 // Helper macro for choosing the variant type.
 #if !ETL_USING_CPP11 || defined(ETL_USE_LEGACY_VARIANT)
@@ -616,6 +660,13 @@ typedef uint_least32_t char32_t;
   #endif
 #endif
 
+//*************************************
+// The size of a cache line.
+// Used to separate data that is modified by different cores.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
 //*************************************
 // Determine if the ETL should use std::initializer_list.
 #if (defined(ETL_FORCE_ETL_INITIALIZER_LIST) && defined(ETL_FORCE_STD_INITIALIZER_LIST))
@@ -702,6 +753,11 @@ namespace etl
     static ETL_CONSTANT bool using_libc_wchar_h               = (ETL_USING_LIBC_WCHAR_H == 1);
     static ETL_CONSTANT bool using_std_exception              = (ETL_USING_STD_EXCEPTION == 1);
     static ETL_CONSTANT bool using_format_floating_point      = (ETL_USING_FORMAT_FLOATING_POINT == 1);
+    static ETL_CONSTANT bool using_ssse3                      = (ETL_USING_SSSE3 == 1);
+    static ETL_CONSTANT bool using_sse42                      = (ETL_USING_SSE42 == 1);
+    static ETL_CONSTANT bool using_pclmul                     = (ETL_USING_PCLMUL == 1);
+    static ETL_CONSTANT bool using_arm_crc32                  = (ETL_USING_ARM_CRC32 == 1);
+    static ETL_CONSTANT bool using_arm_pmull                  = (ETL_USING_ARM_PMULL == 1);
 
     // Has...
     static ETL_CONSTANT bool has_initializer_list             = (ETL_HAS_INITIALIZER_LIST == 1);
@@ -0,0 +1,1029 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_ATOMIC_INCLUDED
+#define ETL_POOL_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "error_handler.h"
+#include "ipool.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+/// The number of bits of a pool_atomic's free list head that hold the index of
+/// the first free item. The rest hold the ABA tag.
+/// The default is half of a uintptr_t. On a 32 bit platform this leaves a 16
+/// bit tag, which could wrap if a thread is pre-empted between loading the
+/// head and its compare-exchange while 65536 other updates are made. A profile
+/// with smaller pools may define fewer bits to make the tag wider.
+//*****************************************************************************
+#if !defined(ETL_POOL_ATOMIC_LINK_BITS)
+  #define ETL_POOL_ATOMIC_LINK_BITS ((sizeof(uintptr_t) * CHAR_BIT) / 2U)
+#endif
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  template <size_t VCapacity>
+  class pool_atomic_cache;
+
+  //***************************************************************************
+  ///\ingroup pool
+  /// The base class for lock free pools.
+  /// The free list is a stack of item indexes. The head of the stack holds the
+  /// index of the first free item and a tag that changes every time the head
+  /// changes, so that a compare-exchange cannot succeed on a head that has been
+  /// popped and pushed back in the meantime (the ABA problem).
+  /// The head is a single uintptr_t, so that it is always lock free. By default,
+  /// half of it is the index and half is the tag. See ETL_POOL_ATOMIC_LINK_BITS.
+  /// The links between free items are kept outside of the items, so that a
+  /// thread reading a stale link never reads memory owned by a user.
+  //***************************************************************************
+  class ipool_atomic
+  {
+  public:
+
+    typedef size_t   size_type;
+    typedef uint32_t link_type; ///< One plus the index of an item. Zero is the end of the free list.
+
+    /// The number of bits of the head used for the link.
+    static ETL_CONSTANT size_t Link_Bits = ETL_POOL_ATOMIC_LINK_BITS;
+
+    ETL_STATIC_ASSERT((Link_Bits >= 2U) && (Link_Bits <= 32U) && (Link_Bits < (sizeof(uintptr_t) * CHAR_BIT)), "Invalid ETL_POOL_ATOMIC_LINK_BITS");
+
+    /// The maximum number of items in a pool.
+    static ETL_CONSTANT size_t Max_Items = size_t((uintptr_t(1) << Link_Bits) - 2U);
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// May be called from any thread.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      link_type link = pop_link();
+
+      ETL_ASSERT(link != 0U, ETL_ERROR(pool_no_allocation));
+
+      return reinterpret_cast<T*>(get_item(link));
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1
+    /// parameter.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// May be called from any thread.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// May be called from any thread.
+    /// If asserts or exceptions are enabled and the object does not belong to
+    /// this pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const char* p = static_cast<const char*>(p_object);
+
+      ETL_ASSERT_OR_RETURN(is_item_in_pool(p), ETL_ERROR(pool_object_not_in_pool));
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(pool_no_allocation));
+
+      link_type link = get_link(p);
+
+      push_links(link, link, 1U);
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object) const
+    {
+      return is_item_in_pool(static_cast<const char*>(p_object));
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum size of an item in the pool.
+    //*************************************************************************
+    size_t max_item_size() const
+    {
+      return Item_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// Items held in an etl::pool_atomic_cache are not free.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// Items held in an etl::pool_atomic_cache are counted as allocated.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// \return <b>true</b> if there are none allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// \return <b>true</b> if there are none free.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == Max_Size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ipool_atomic(char* p_buffer_, etl::atomic<link_type>* p_links_, uint32_t item_size_, uint32_t max_size_)
+      : p_buffer(p_buffer_)
+      , p_links(p_links_)
+      , head(0)
+      , items_allocated(0)
+      , Item_Size(item_size_)
+      , Max_Size(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Puts every item on the free list.
+    /// Called from the derived class, after the links have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (uint32_t i = 0U; i < Max_Size; ++i)
+      {
+        link_type next = (i + 1U) < Max_Size ? link_type(i + 2U) : link_type(0U);
+        p_links[i].store(next, etl::memory_order_relaxed);
+      }
+
+      items_allocated.store(0U, etl::memory_order_relaxed);
+      head.store((Max_Size != 0U) ? uintptr_t(1U) : uintptr_t(0U), etl::memory_order_release);
+    }
+
+  private:
+
+    template <size_t VCapacity>
+    friend class etl::pool_atomic_cache;
+
+    static ETL_CONSTANT uintptr_t Link_Mask = (uintptr_t(1) << Link_Bits) - 1U;
+
+    //*************************************************************************
+    /// Makes a new head from the old one, with the tag incremented.
+    //*************************************************************************
+    static uintptr_t make_head(uintptr_t old_head, link_type link)
+    {
+      return ((old_head & ~Link_Mask) + (Link_Mask + 1U)) | uintptr_t(link);
+    }
+
+    //*************************************************************************
+    /// Pops the first free item.
+    /// Returns zero if there are no free items.
+    //*************************************************************************
+    link_type pop_link()
+    {
+      uintptr_t old_head = head.load(etl::memory_order_acquire);
+
+      for (;;)
+      {
+        link_type link = link_type(old_head & Link_Mask);
+
+        if (link == 0U)
+        {
+          return 0U;
+        }
+
+        // If another thread pops this item first, the link may be stale, but
+        // then the tag will have changed and the exchange will fail.
+        link_type next = p_links[link - 1U].load(etl::memory_order_relaxed);
+
+        if (head.compare_exchange_weak(old_head, make_head(old_head, next), etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          items_allocated.fetch_add(1U, etl::memory_order_relaxed);
+          return link;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Pops a chain of up to 'n' free items into 'links' with a single
+    /// exchange.
+    /// Returns the number of items popped.
+    //*************************************************************************
+    size_t pop_links(link_type* links, size_t n)
+    {
+      uintptr_t old_head = head.load(etl::memory_order_acquire);
+
+      for (;;)
+      {
+        link_type link  = link_type(old_head & Link_Mask);
+        size_t    count = 0U;
+
+        // The chain below the head only changes when the head does, so if
+        // the exchange succeeds, the links read here were not stale.
+        while ((link != 0U) && (count < n))
+        {
+          links[count++] = link;
+          link           = p_links[link - 1U].load(etl::memory_order_relaxed);
+        }
+
+        if (count == 0U)
+        {
+          return 0U;
+        }
+
+        if (head.compare_exchange_weak(old_head, make_head(old_head, link), etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          items_allocated.fetch_add(uint32_t(count), etl::memory_order_relaxed);
+          return count;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Pushes a chain of 'count' free items, already linked from 'first' to
+    /// 'last', with a single exchange.
+    //*************************************************************************
+    void push_links(link_type first, link_type last, uint32_t count)
+    {
+      uintptr_t old_head = head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        p_links[last - 1U].store(link_type(old_head & Link_Mask), etl::memory_order_relaxed);
+      } while (!head.compare_exchange_weak(old_head, make_head(old_head, first), etl::memory_order_release, etl::memory_order_relaxed));
+
+      items_allocated.fetch_sub(count, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Links 'previous' to 'next' in a chain that is about to be pushed.
+    //*************************************************************************
+    void set_next_link(link_type previous, link_type next)
+    {
+      p_links[previous - 1U].store(next, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Gets the item for a link.
+    //*************************************************************************
+    char* get_item(link_type link) const
+    {
+      return (link == 0U) ? ETL_NULLPTR : p_buffer + (size_t(link - 1U) * Item_Size);
+    }
+
+    //*************************************************************************
+    /// Gets the link for an item.
+    //*************************************************************************
+    link_type get_link(const char* p) const
+    {
+      return link_type((size_t(p - p_buffer) / Item_Size) + 1U);
+    }
+
+    //*************************************************************************
+    /// Check if the item belongs to this pool.
+    //*************************************************************************
+    bool is_item_in_pool(const char* p) const
+    {
+      // Within the range of the buffer?
+      intptr_t distance        = p - p_buffer;
+      bool     is_within_range = (distance >= 0) && (distance <= intptr_t((Item_Size * Max_Size) - Item_Size));
+
+      // Modulus and division can be slow on some architectures, so only do this
+      // in debug.
+#if ETL_IS_DEBUG_BUILD
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((static_cast<size_t>(distance) % Item_Size) == 0);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    // Disable copy construction and assignment.
+    ipool_atomic(const ipool_atomic&) ETL_DELETE;
+    ipool_atomic& operator=(const ipool_atomic&) ETL_DELETE;
+
+    char* const                   p_buffer;        ///< The items.
+    etl::atomic<link_type>* const p_links;         ///< The links of the free list.
+    etl::atomic<uintptr_t>        head;            ///< The tag and link of the first free item.
+    etl::atomic<uint32_t>         items_allocated; ///< The number of items allocated.
+
+    const uint32_t Item_Size; ///< The size of allocated items.
+    const uint32_t Max_Size;  ///< The maximum number of objects that can be allocated.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~ipool_atomic() {}
+#else
+
+  protected:
+
+    ~ipool_atomic() {}
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated abstract lock free pool implementation that uses a fixed
+  /// size pool.
+  ///\ingroup pool
+  //*************************************************************************
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  class generic_pool_atomic : public etl::ipool_atomic
+  {
+  public:
+
+    static ETL_CONSTANT size_t SIZE      = VSize;
+    static ETL_CONSTANT size_t ALIGNMENT = VAlignment;
+    static ETL_CONSTANT size_t TYPE_SIZE = VTypeSize;
+
+    ETL_STATIC_ASSERT(VSize <= etl::ipool_atomic::Max_Items, "Too many items for the pool's link type");
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_pool_atomic()
+      : etl::ipool_atomic(reinterpret_cast<char*>(&buffer[0]), links, Element_Size, VSize)
+    {
+      // The links are constructed after the base.
+      etl::ipool_atomic::initialise();
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::allocate<U>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1
+    /// parameter.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2
+    /// parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3
+    /// parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4
+    /// parameters.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      ipool_atomic::destroy(p_object);
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char                                                value[VTypeSize]; ///< Storage for value type.
+      typename etl::type_with_alignment<VAlignment>::type dummy;            ///< Dummy item to get correct alignment.
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage< sizeof(Element), etl::alignment_of<Element>::value>::type buffer[VSize];
+
+    ///< The links of the free list.
+    etl::atomic<link_type> links[VSize];
+
+    static ETL_CONSTANT uint32_t Element_Size = sizeof(Element);
+
+    // Should not be copied.
+    generic_pool_atomic(const generic_pool_atomic&) ETL_DELETE;
+    generic_pool_atomic& operator=(const generic_pool_atomic&) ETL_DELETE;
+  };
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::SIZE;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::ALIGNMENT;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::TYPE_SIZE;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT uint32_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::Element_Size;
+
+  //*************************************************************************
+  /// A templated lock free pool implementation that uses a fixed size pool.
+  /// Objects may be allocated and released from any thread.
+  ///\ingroup pool
+  //*************************************************************************
+  template <typename T, const size_t VSize>
+  class pool_atomic : public etl::generic_pool_atomic<sizeof(T), etl::alignment_of<T>::value, VSize>
+  {
+  private:
+
+    typedef etl::generic_pool_atomic<sizeof(T), etl::alignment_of<T>::value, VSize> base_t;
+
+  public:
+
+    using base_t::ALIGNMENT;
+    using base_t::SIZE;
+    using base_t::TYPE_SIZE;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    pool_atomic() {}
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    T* allocate()
+    {
+      return base_t::template allocate<T>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    //*************************************************************************
+    T* create()
+    {
+      return base_t::template create<T>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1
+    /// parameter.
+    //*************************************************************************
+    template <typename T1>
+    T* create(const T1& value1)
+    {
+      return base_t::template create<T>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2
+    /// parameters.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      return base_t::template create<T>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3
+    /// parameters.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return base_t::template create<T>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4
+    /// parameters.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return base_t::template create<T>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+      return base_t::template create<T>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      base_t::destroy(p_object);
+    }
+
+  private:
+
+    // Should not be copied.
+    pool_atomic(const pool_atomic&) ETL_DELETE;
+    pool_atomic& operator=(const pool_atomic&) ETL_DELETE;
+  };
+
+  //*************************************************************************
+  /// A cache of free items from an etl::ipool_atomic, for use by one thread.
+  /// Allocations and releases only use the shared free list when the cache is
+  /// empty or full, and then move half of the cache's capacity in one go.
+  /// Each thread that uses the pool heavily should have its own cache.
+  /// The cache returns its items to the pool when it is destroyed.
+  /// Items in a cache are not available to other threads, so a pool may
+  /// appear to be empty while caches hold free items.
+  ///\tparam VCapacity The maximum number of free items in the cache.
+  ///\ingroup pool
+  //*************************************************************************
+  template <size_t VCapacity>
+  class pool_atomic_cache
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VCapacity >= 2U, "The cache capacity must be at least 2");
+
+    static ETL_CONSTANT size_t CAPACITY = VCapacity;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    explicit pool_atomic_cache(etl::ipool_atomic& pool_)
+      : pool(pool_)
+      , count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns the cached items to the pool.
+    //*************************************************************************
+    ~pool_atomic_cache()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the cache, refilling it from the
+    /// pool if necessary.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > pool.max_item_size())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      if (count == 0U)
+      {
+        refill();
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(count != 0U, ETL_ERROR(pool_no_allocation), ETL_NULLPTR);
+
+      return reinterpret_cast<T*>(pool.get_item(links[--count]));
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object and create default.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 1 parameter.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object and keeps its storage in the cache.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > pool.max_item_size())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Releases an object to the cache, returning half of the cache to the
+    /// pool if it is full.
+    /// The object may have been allocated by any thread.
+    /// If asserts or exceptions are enabled and the object does not belong to
+    /// the pool then an etl::pool_object_not_in_pool is thrown.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const char* p = static_cast<const char*>(p_object);
+
+      ETL_ASSERT_OR_RETURN(pool.is_item_in_pool(p), ETL_ERROR(pool_object_not_in_pool));
+
+      if (count == VCapacity)
+      {
+        spill(VCapacity / 2U);
+      }
+
+      links[count++] = pool.get_link(p);
+    }
+
+    //*************************************************************************
+    /// Returns all of the cached items to the pool.
+    //*************************************************************************
+    void flush()
+    {
+      spill(count);
+    }
+
+    //*************************************************************************
+    /// The number of free items held in the cache.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+  private:
+
+    typedef etl::ipool_atomic::link_type link_type;
+
+    //*************************************************************************
+    /// Takes up to half of the cache's capacity from the pool as one chain.
+    //*************************************************************************
+    void refill()
+    {
+      count += pool.pop_links(links + count, (VCapacity / 2U) - count);
+    }
+
+    //*************************************************************************
+    /// Returns the 'n' least recently cached items to the pool as one chain,
+    /// keeping the most recently used items in the cache.
+    //*************************************************************************
+    void spill(size_t n)
+    {
+      if (n != 0U)
+      {
+        for (size_t i = 1U; i < n; ++i)
+        {
+          pool.set_next_link(links[i - 1U], links[i]);
+        }
+
+        pool.push_links(links[0], links[n - 1U], uint32_t(n));
+
+        etl::copy(links + n, links + count, links);
+        count -= n;
+      }
+    }
+
+    // Should not be copied.
+    pool_atomic_cache(const pool_atomic_cache&) ETL_DELETE;
+    pool_atomic_cache& operator=(const pool_atomic_cache&) ETL_DELETE;
+
+    etl::ipool_atomic& pool;             ///< The pool that the items belong to.
+    size_t             count;            ///< The number of cached items.
+    link_type          links[VCapacity]; ///< The cached items.
+  };
+
+  template <size_t VCapacity>
+  ETL_CONSTANT size_t pool_atomic_cache<VCapacity>::CAPACITY;
+} // namespace etl
+
+#endif
+
+#endif
@@ -0,0 +1,230 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_WAIT_INCLUDED
+#define ETL_ATOMIC_WAIT_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+
+#if ETL_USING_CPP11
+  #include "../chrono.h"
+#endif
+
+#include <stdint.h>
+
+//*****************************************************************************
+// The maximum number of CPU relax hints in the last round of spinning before
+// a waiting thread parks. Each round doubles the number of hints.
+//*****************************************************************************
+#if !defined(ETL_ATOMIC_WAIT_SPIN_LIMIT)
+  #define ETL_ATOMIC_WAIT_SPIN_LIMIT 1024
+#endif
+
+//*****************************************************************************
+// Called repeatedly by a waiting thread after it has finished spinning, when
+// the atomic cannot be waited on.
+// May be defined to an RTOS yield.
+//*****************************************************************************
+#if !defined(ETL_ATOMIC_WAIT_YIELD)
+  #if ETL_USING_STL && ETL_USING_CPP11
+    #include <thread>
+    #define ETL_ATOMIC_WAIT_YIELD() std::this_thread::yield()
+  #else
+    #define ETL_ATOMIC_WAIT_YIELD()
+  #endif
+#endif
+
+//*****************************************************************************
+// Called by a thread in a wait with a timeout, after it has finished spinning.
+// Sleeps for up to the number of microseconds. The waiting thread checks the
+// value and the deadline between sleeps.
+// May be defined to an RTOS sleep.
+//*****************************************************************************
+#if !defined(ETL_ATOMIC_WAIT_SLEEP)
+  #if ETL_USING_STL && ETL_USING_CPP11
+    #include <chrono>
+    #include <thread>
+    #define ETL_ATOMIC_WAIT_SLEEP(time_us) std::this_thread::sleep_for(std::chrono::microseconds(time_us))
+  #else
+    #define ETL_ATOMIC_WAIT_SLEEP(time_us) ETL_ATOMIC_WAIT_YIELD()
+  #endif
+#endif
+
+//*****************************************************************************
+// The longest sleep, in microseconds, of a thread in a wait with a timeout.
+// Each sleep doubles in length up to this limit, so it is the longest that a
+// change to the value may go unseen.
+//*****************************************************************************
+#if !defined(ETL_ATOMIC_WAIT_SLEEP_LIMIT)
+  #define ETL_ATOMIC_WAIT_SLEEP_LIMIT 1000
+#endif
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_atomic_wait
+  {
+    //*************************************************************************
+    /// Tells the CPU that the thread is in a spin loop.
+    //*************************************************************************
+    inline void cpu_relax()
+    {
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__i386__) || defined(__x86_64__))
+      __builtin_ia32_pause();
+  #elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+      __asm__ __volatile__("yield");
+  #endif
+    }
+
+    //*************************************************************************
+    /// Spins while 'value' equals 'old', backing off exponentially.
+    /// Returns true if the value changed.
+    //*************************************************************************
+    template <typename T>
+    bool spin_while_equal(const etl::atomic<T>& value, T old)
+    {
+      for (uint32_t spins = 1U; spins <= uint32_t(ETL_ATOMIC_WAIT_SPIN_LIMIT); spins *= 2U)
+      {
+        if (value.load(etl::memory_order_acquire) != old)
+        {
+          return true;
+        }
+
+        for (uint32_t i = 0U; i < spins; ++i)
+        {
+          cpu_relax();
+        }
+      }
+
+      return value.load(etl::memory_order_acquire) != old;
+    }
+
+  #if ETL_HAS_ATOMIC_WAIT
+    //*************************************************************************
+    /// Waits while 'value' equals 'old'.
+    /// Spins, then sets 'waiting' and blocks on the atomic. The thread that
+    /// changes the value only calls notify if 'waiting' is set, so a queue
+    /// that is never waited on does not pay for it.
+    /// The caller must check its condition again on return.
+    //*************************************************************************
+    template <typename T>
+    void wait_while_equal(const etl::atomic<T>& value, T old, etl::atomic<bool>& waiting)
+    {
+      if (!spin_while_equal(value, old))
+      {
+        waiting.store(true, etl::memory_order_relaxed);
+
+        // Pairs with the fence in notify. Either this thread sees the new
+        // value, or the notifying thread sees 'waiting'.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        value.wait(old, etl::memory_order_acquire);
+
+        waiting.store(false, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Wakes a thread blocked in wait_while_equal on 'value', if there is one.
+    /// Must be called after 'value' is changed.
+    //*************************************************************************
+    template <typename T>
+    void notify(etl::atomic<T>& value, const etl::atomic<bool>& waiting)
+    {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      if (waiting.load(etl::memory_order_relaxed))
+      {
+        value.notify_one();
+      }
+    }
+  #else
+    //*************************************************************************
+    /// Waits while 'value' equals 'old'.
+    /// Spins, then calls ETL_ATOMIC_WAIT_YIELD once. The caller must check its
+    /// condition again on return.
+    //*************************************************************************
+    template <typename T>
+    void wait_while_equal(const etl::atomic<T>& value, T old)
+    {
+      if (!spin_while_equal(value, old))
+      {
+        ETL_ATOMIC_WAIT_YIELD();
+      }
+    }
+  #endif
+
+  #if ETL_USING_CPP11
+    //*************************************************************************
+    /// Waits while 'value' equals 'old', until 'deadline'.
+    /// Spins, then sleeps with ETL_ATOMIC_WAIT_SLEEP until the value changes or
+    /// the deadline passes, as an atomic wait cannot time out. The sleeps
+    /// double in length up to ETL_ATOMIC_WAIT_SLEEP_LIMIT, and never go past
+    /// the deadline.
+    /// Returns false if the deadline passed.
+    //*************************************************************************
+    template <typename T, typename TClock, typename TDuration>
+    bool wait_while_equal_until(const etl::atomic<T>& value, T old, const etl::chrono::time_point<TClock, TDuration>& deadline)
+    {
+      if (spin_while_equal(value, old))
+      {
+        return true;
+      }
+
+      int64_t sleep_us = 1;
+
+      while (value.load(etl::memory_order_acquire) == old)
+      {
+        const etl::chrono::time_point<TClock, TDuration> now = TClock::now();
+
+        if (now >= deadline)
+        {
+          return false;
+        }
+
+        const int64_t remaining = static_cast<int64_t>(etl::chrono::duration_cast<etl::chrono::microseconds>(deadline - now).count());
+
+        ETL_ATOMIC_WAIT_SLEEP((remaining < sleep_us) ? ((remaining < 1) ? 1 : remaining) : sleep_us);
+
+        sleep_us = ((2 * sleep_us) < int64_t(ETL_ATOMIC_WAIT_SLEEP_LIMIT)) ? (2 * sleep_us) : int64_t(ETL_ATOMIC_WAIT_SLEEP_LIMIT);
+      }
+
+      return true;
+    }
+  #endif
+
+  } // namespace private_atomic_wait
+} // namespace etl
+
+#endif
+
+#endif
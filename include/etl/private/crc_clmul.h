@@ -0,0 +1,357 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_CLMUL_INCLUDED
+#define ETL_CRC_CLMUL_INCLUDED
+
+#include "../platform.h"
+#include "crc_implementation.h"
+
+//*****************************************************************************
+/// Carry-less multiply CRC folding.
+/// Enabled for C++14 and above when the compiler is targeting x86 with
+/// PCLMULQDQ, or little endian AArch64 with PMULL.
+/// Define ETL_NO_CRC_CLMUL to disable.
+//*****************************************************************************
+#if ETL_USING_CPP14 && ETL_USING_PCLMUL && !defined(ETL_NO_CRC_CLMUL)
+  #define ETL_USING_CRC_CLMUL 1
+  #define ETL_CRC_CLMUL_X86   1
+  #include <emmintrin.h>
+  #include <wmmintrin.h>
+#elif ETL_USING_CPP14 && ETL_USING_ARM_PMULL && !defined(ETL_NO_CRC_CLMUL) && defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN)
+  #define ETL_USING_CRC_CLMUL 1
+  #define ETL_CRC_CLMUL_ARM   1
+  #include <arm_neon.h>
+#else
+  #define ETL_USING_CRC_CLMUL 0
+#endif
+
+#if ETL_USING_CRC_CLMUL
+  #include <stddef.h>
+  #include <stdint.h>
+  #include <string.h>
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*****************************************************************************
+    /// The multipliers that fold a 128 bit block forward over 128, 256, 384 and
+    /// 512 bits of following data.
+    /// Each pair is stored as the low and high 64 bit words of a vector, with each
+    /// multiplier in the same word as the half of the block that it multiplies.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_clmul_constants
+    {
+      //*************************************************************************
+      ETL_CONSTEXPR14 crc_clmul_constants()
+        : multiplier()
+      {
+        for (size_t i = 0U; i < 4U; ++i)
+        {
+          const size_t distance = 128U * (i + 1U);
+
+          // The first half of the block is 64 bits further from the end than the second.
+          const uint64_t first  = fold_multiplier(distance + 64U);
+          const uint64_t second = fold_multiplier(distance);
+
+          multiplier[i][0U] = Reflect ? first : second;
+          multiplier[i][1U] = Reflect ? second : first;
+        }
+      }
+
+      //*************************************************************************
+      /// x^n mod P, in the bit order used by the fold.
+      /// The reflected form is one power lower, as a carry-less multiply of
+      /// reflected values is one bit short of the reflected product.
+      //*************************************************************************
+      static ETL_CONSTEXPR14 uint64_t fold_multiplier(size_t n)
+      {
+        const uint64_t top_bit = uint64_t(1U) << (Accumulator_Bits - 1U);
+        const uint64_t mask    = (top_bit << 1U) - 1U;
+
+        uint64_t remainder = 1U;
+
+        for (size_t i = 0U; i < (Reflect ? n - 1U : n); ++i)
+        {
+          remainder = ((remainder & top_bit) != 0U) ? (((remainder << 1U) ^ uint64_t(Polynomial)) & mask) : ((remainder << 1U) & mask);
+        }
+
+        return Reflect ? reflect(remainder) : remainder;
+      }
+
+      //*************************************************************************
+      static ETL_CONSTEXPR14 uint64_t reflect(uint64_t value)
+      {
+        uint64_t result = 0U;
+
+        for (size_t i = 0U; i < 64U; ++i)
+        {
+          result = (result << 1U) | ((value >> i) & 1U);
+        }
+
+        return result;
+      }
+
+      uint64_t multiplier[4U][2U];
+    };
+
+    //*****************************************************************************
+    /// Policy for 32 and 64 bit CRCs using carry-less multiplication.
+    /// Blocks of 64 bytes or more are folded 64 bytes at a time into four
+    /// 128 bit remainders, which are then folded into one. The result, and any
+    /// bytes that remain, are added with the 256 entry table.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_clmul_policy
+      : public crc_table<typename TCrcParameters::accumulator_type, TCrcParameters::Accumulator_Bits, 8U, 0xFFU, TCrcParameters::Polynomial,
+                         TCrcParameters::Reflect, 256U>
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type                          value_type;
+
+      ETL_STATIC_ASSERT((TCrcParameters::Accumulator_Bits == 32U) || (TCrcParameters::Accumulator_Bits == 64U), "Only 32 and 64 bit CRCs are supported");
+
+      typedef crc_clmul_constants<accumulator_type, TCrcParameters::Accumulator_Bits, TCrcParameters::Polynomial, TCrcParameters::Reflect> constants_type;
+
+      static ETL_CONSTANT constants_type constants = constants_type();
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type add_block(accumulator_type crc, const uint8_t* p, size_t length) const
+      {
+        if (length >= 64U)
+        {
+          // Moving the CRC into the first bytes of data lets the folding start from zero.
+          uint8_t first[16U];
+          memcpy(first, p, 16U);
+
+          for (size_t i = 0U; i < Accumulator_Bytes; ++i)
+          {
+            first[i] ^= TCrcParameters::Reflect ? uint8_t(crc >> (8U * i)) : uint8_t(crc >> (TCrcParameters::Accumulator_Bits - 8U - (8U * i)));
+          }
+
+          lane_type x0 = load(first);
+          lane_type x1 = load(p + 16U);
+          lane_type x2 = load(p + 32U);
+          lane_type x3 = load(p + 48U);
+          p      += 64U;
+          length -= 64U;
+
+          const lane_type by_512 = load_multiplier(3U);
+
+          while (length >= 64U)
+          {
+            x0 = fold(x0, by_512, load(p));
+            x1 = fold(x1, by_512, load(p + 16U));
+            x2 = fold(x2, by_512, load(p + 32U));
+            x3 = fold(x3, by_512, load(p + 48U));
+            p      += 64U;
+            length -= 64U;
+          }
+
+          const lane_type by_128 = load_multiplier(0U);
+
+          lane_type x = fold(x2, by_128, x3);
+          x           = fold(x1, load_multiplier(1U), x);
+          x           = fold(x0, load_multiplier(2U), x);
+
+          while (length >= 16U)
+          {
+            x = fold(x, by_128, load(p));
+            p      += 16U;
+            length -= 16U;
+          }
+
+          // The CRC of the data so far is the CRC of the remainder from zero.
+          uint8_t remainder[16U];
+          store(remainder, x);
+
+          crc = 0U;
+
+          for (size_t i = 0U; i < 16U; ++i)
+          {
+            crc = this->add(crc, remainder[i]);
+          }
+        }
+
+        while (length-- != 0U)
+        {
+          crc = this->add(crc, *p++);
+        }
+
+        return crc;
+      }
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+
+    private:
+
+      static ETL_CONSTANT size_t Accumulator_Bytes = TCrcParameters::Accumulator_Bits / 8U;
+
+  #if defined(ETL_CRC_CLMUL_X86)
+      typedef __m128i lane_type;
+  #else
+      typedef uint64x2_t lane_type;
+  #endif
+
+      //*************************************************************************
+      /// The 16 bytes as a 128 bit polynomial, with the first bit of the data as
+      /// the highest power of x, bit reflected when the CRC is.
+      //*************************************************************************
+      static lane_type load(const uint8_t* p)
+      {
+        uint64_t low;
+        uint64_t high;
+        memcpy(&low, p, 8U);
+        memcpy(&high, p + 8U, 8U);
+
+        if (!TCrcParameters::Reflect)
+        {
+          const uint64_t first = etl::reverse_bytes(low);
+          low                  = etl::reverse_bytes(high);
+          high                 = first;
+        }
+
+        return make_lane(low, high);
+      }
+
+      //*************************************************************************
+      static void store(uint8_t* p, lane_type x)
+      {
+        uint64_t low;
+        uint64_t high;
+  #if defined(ETL_CRC_CLMUL_X86)
+        uint8_t bytes[16U];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), x);
+        memcpy(&low, bytes, 8U);
+        memcpy(&high, bytes + 8U, 8U);
+  #else
+        low  = vgetq_lane_u64(x, 0);
+        high = vgetq_lane_u64(x, 1);
+  #endif
+
+        if (!TCrcParameters::Reflect)
+        {
+          const uint64_t first = etl::reverse_bytes(high);
+          high                 = etl::reverse_bytes(low);
+          low                  = first;
+        }
+
+        memcpy(p, &low, 8U);
+        memcpy(p + 8U, &high, 8U);
+      }
+
+      //*************************************************************************
+      static lane_type load_multiplier(size_t index)
+      {
+        return make_lane(constants.multiplier[index][0U], constants.multiplier[index][1U]);
+      }
+
+      //*************************************************************************
+      static lane_type make_lane(uint64_t low, uint64_t high)
+      {
+  #if defined(ETL_CRC_CLMUL_X86)
+        return _mm_set_epi64x(static_cast<long long>(high), static_cast<long long>(low));
+  #else
+        return vcombine_u64(vcreate_u64(low), vcreate_u64(high));
+  #endif
+      }
+
+      //*************************************************************************
+      /// Folds x forward over the following data, and adds the data.
+      //*************************************************************************
+      static lane_type fold(lane_type x, lane_type multiplier, lane_type data)
+      {
+  #if defined(ETL_CRC_CLMUL_X86)
+        const __m128i low  = _mm_clmulepi64_si128(x, multiplier, 0x00);
+        const __m128i high = _mm_clmulepi64_si128(x, multiplier, 0x11);
+
+        return _mm_xor_si128(_mm_xor_si128(low, high), data);
+  #else
+        const uint64x2_t low  = vreinterpretq_u64_p128(vmull_p64(vgetq_lane_p64(vreinterpretq_p64_u64(x), 0), vgetq_lane_p64(vreinterpretq_p64_u64(multiplier), 0)));
+        const uint64x2_t high = vreinterpretq_u64_p128(vmull_p64(vgetq_lane_p64(vreinterpretq_p64_u64(x), 1), vgetq_lane_p64(vreinterpretq_p64_u64(multiplier), 1)));
+
+        return veorq_u64(veorq_u64(low, high), data);
+  #endif
+      }
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT typename crc_clmul_policy<TCrcParameters>::constants_type crc_clmul_policy<TCrcParameters>::constants;
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT size_t crc_clmul_policy<TCrcParameters>::Accumulator_Bytes;
+  } // namespace private_crc
+
+  //*****************************************************************************
+  /// CRC calculated with carry-less multiplication.
+  //*****************************************************************************
+  template <typename TCrcParameters>
+  class crc_clmul_type : public etl::frame_check_sequence< private_crc::crc_clmul_policy<TCrcParameters> >
+  {
+  public:
+
+    typedef TCrcParameters parameters_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc_clmul_type()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template <typename TIterator>
+    crc_clmul_type(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+} // namespace etl
+#endif
+
+#endif
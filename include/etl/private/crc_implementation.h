@@ -613,6 +613,145 @@ namespace etl
           template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
           ETL_CONSTANT TAccumulator crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 256U>::table[256U];
 #endif
+
+#if ETL_USING_CPP14
+          //*****************************************************************************
+          /// The tables for slicing by 4, 8 or 16 bytes.
+          /// table[0] is the 256 entry table. table[k] holds the effect of a byte
+          /// followed by k zero bytes.
+          //*****************************************************************************
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+          struct crc_slice_tables
+          {
+            //*************************************************************************
+            ETL_CONSTEXPR14 crc_slice_tables()
+              : table()
+            {
+              const TAccumulator reflected_polynomial = etl::reverse_bits_const<TAccumulator, Polynomial>::value;
+              const TAccumulator top_bit              = TAccumulator(TAccumulator(1U) << (Accumulator_Bits - 1U));
+
+              for (size_t i = 0U; i < 256U; ++i)
+              {
+                TAccumulator crc = Reflect ? TAccumulator(i) : TAccumulator(TAccumulator(i) << (Accumulator_Bits - 8U));
+
+                for (size_t bit = 0U; bit < 8U; ++bit)
+                {
+                  if (Reflect)
+                  {
+                    crc = ((crc & 1U) != 0U) ? TAccumulator((crc >> 1U) ^ reflected_polynomial) : TAccumulator(crc >> 1U);
+                  }
+                  else
+                  {
+                    crc = ((crc & top_bit) != 0U) ? TAccumulator((crc << 1U) ^ Polynomial) : TAccumulator(crc << 1U);
+                  }
+                }
+
+                table[0U][i] = crc;
+              }
+
+              for (size_t k = 1U; k < Slices; ++k)
+              {
+                for (size_t i = 0U; i < 256U; ++i)
+                {
+                  const TAccumulator previous = table[k - 1U][i];
+
+                  table[k][i] = TAccumulator(shift_out_byte(previous) ^ table[0U][leading_byte(previous)]);
+                }
+              }
+            }
+
+            //*************************************************************************
+            /// The byte of the CRC that is combined with the next input byte.
+            //*************************************************************************
+            static ETL_CONSTEXPR14 uint8_t leading_byte(TAccumulator crc, size_t position = 0U)
+            {
+              return Reflect ? uint8_t(crc >> (8U * position)) : uint8_t(crc >> (Accumulator_Bits - 8U - (8U * position)));
+            }
+
+            //*************************************************************************
+            /// The CRC with the leading byte shifted out.
+            //*************************************************************************
+            static ETL_CONSTEXPR14 TAccumulator shift_out_byte(TAccumulator crc)
+            {
+              return (Accumulator_Bits == 8U) ? TAccumulator(0U) : Reflect ? TAccumulator(crc >> Byte_Shift) : TAccumulator(crc << Byte_Shift);
+            }
+
+            // Keeps the shift in range when the accumulator is 8 bits.
+            static ETL_CONSTANT size_t Byte_Shift = (Accumulator_Bits == 8U) ? 0U : 8U;
+
+            TAccumulator table[Slices][256U];
+          };
+
+          //*****************************************************************************
+          /// CRC table slicing by 4, 8 or 16 bytes.
+          /// Each step combines Slices bytes of input with independent table lookups.
+          //*****************************************************************************
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+          struct crc_slice_table
+          {
+            typedef crc_slice_tables<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices> tables_type;
+
+            static ETL_CONSTANT tables_type tables = tables_type();
+
+            //*************************************************************************
+            ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value) const
+            {
+              return TAccumulator(tables_type::shift_out_byte(crc) ^ tables.table[0U][uint8_t(tables_type::leading_byte(crc) ^ value)]);
+            }
+
+            //*************************************************************************
+            TAccumulator add_slices(TAccumulator crc, const uint8_t* p, size_t length) const
+            {
+              while (length >= Slices)
+              {
+                TAccumulator next = (Accumulator_Bits > Slice_Bits) ? shift_out_slice(crc) : TAccumulator(0U);
+
+                for (size_t i = 0U; i < Slices; ++i)
+                {
+                  uint8_t index = p[i];
+
+                  if (i < Accumulator_Bytes)
+                  {
+                    index ^= tables_type::leading_byte(crc, i);
+                  }
+
+                  next ^= tables.table[Slices - 1U - i][index];
+                }
+
+                crc     = next;
+                p      += Slices;
+                length -= Slices;
+              }
+
+              while (length-- != 0U)
+              {
+                crc = add(crc, *p++);
+              }
+
+              return crc;
+            }
+
+          private:
+
+            //*************************************************************************
+            /// The CRC with the leading slice shifted out, when the accumulator is
+            /// wider than a slice.
+            //*************************************************************************
+            static TAccumulator shift_out_slice(TAccumulator crc)
+            {
+              return Reflect ? TAccumulator(crc >> Slice_Shift) : TAccumulator(crc << Slice_Shift);
+            }
+
+            static ETL_CONSTANT size_t Accumulator_Bytes = Accumulator_Bits / 8U;
+            static ETL_CONSTANT size_t Slice_Bits        = Slices * 8U;
+            static ETL_CONSTANT size_t Slice_Shift       = (Accumulator_Bits > Slice_Bits) ? Slice_Bits : 0U;
+          };
+
+          template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+          ETL_CONSTANT typename crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices>::tables_type
+            crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices>::tables;
+#endif
+
           //*****************************************************************************
           // CRC Policies.
           //*****************************************************************************
@@ -687,6 +826,95 @@ namespace etl
               return crc ^ TCrcParameters::Xor_Out;
             }
           };
+
+#if ETL_USING_CPP14
+          //*********************************
+          // Policy for slicing by 4 bytes, with a 1024 entry table.
+          template <typename TCrcParameters>
+          struct crc_policy<TCrcParameters, 1024U>
+            : public crc_slice_table<typename TCrcParameters::accumulator_type, TCrcParameters::Accumulator_Bits, TCrcParameters::Polynomial,
+                                     TCrcParameters::Reflect, 4U>
+          {
+            typedef typename TCrcParameters::accumulator_type accumulator_type;
+            typedef accumulator_type                          value_type;
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type initial() const
+            {
+              return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value : TCrcParameters::Initial;
+            }
+
+            //*************************************************************************
+            accumulator_type add_block(accumulator_type crc, const uint8_t* p, size_t length) const
+            {
+              return this->add_slices(crc, p, length);
+            }
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+            {
+              return crc ^ TCrcParameters::Xor_Out;
+            }
+          };
+
+          //*********************************
+          // Policy for slicing by 8 bytes, with a 2048 entry table.
+          template <typename TCrcParameters>
+          struct crc_policy<TCrcParameters, 2048U>
+            : public crc_slice_table<typename TCrcParameters::accumulator_type, TCrcParameters::Accumulator_Bits, TCrcParameters::Polynomial,
+                                     TCrcParameters::Reflect, 8U>
+          {
+            typedef typename TCrcParameters::accumulator_type accumulator_type;
+            typedef accumulator_type                          value_type;
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type initial() const
+            {
+              return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value : TCrcParameters::Initial;
+            }
+
+            //*************************************************************************
+            accumulator_type add_block(accumulator_type crc, const uint8_t* p, size_t length) const
+            {
+              return this->add_slices(crc, p, length);
+            }
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+            {
+              return crc ^ TCrcParameters::Xor_Out;
+            }
+          };
+
+          //*********************************
+          // Policy for slicing by 16 bytes, with a 4096 entry table.
+          template <typename TCrcParameters>
+          struct crc_policy<TCrcParameters, 4096U>
+            : public crc_slice_table<typename TCrcParameters::accumulator_type, TCrcParameters::Accumulator_Bits, TCrcParameters::Polynomial,
+                                     TCrcParameters::Reflect, 16U>
+          {
+            typedef typename TCrcParameters::accumulator_type accumulator_type;
+            typedef accumulator_type                          value_type;
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type initial() const
+            {
+              return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value : TCrcParameters::Initial;
+            }
+
+            //*************************************************************************
+            accumulator_type add_block(accumulator_type crc, const uint8_t* p, size_t length) const
+            {
+              return this->add_slices(crc, p, length);
+            }
+
+            //*************************************************************************
+            ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+            {
+              return crc ^ TCrcParameters::Xor_Out;
+            }
+          };
+#endif
         }
 
         //*****************************************************************************
@@ -697,7 +925,15 @@ namespace etl
         {
         public:
 
+          typedef TCrcParameters parameters_type;
+
+#if ETL_USING_CPP14
+          ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 1024U) || (Table_Size == 2048U) ||
+                              (Table_Size == 4096U),
+                            "Table size must be 4, 16, 256, 1024, 2048 or 4096");
+#else
           ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+#endif
 
           //*************************************************************************
           /// Default constructor.
@@ -0,0 +1,106 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RING_INDEX_INCLUDED
+#define ETL_RING_INDEX_INCLUDED
+
+#include "../platform.h"
+
+namespace etl
+{
+  namespace private_ring_index
+  {
+    //*************************************************************************
+    /// Index arithmetic for ring buffers that keep one slot free, so that
+    /// 'read == write' means empty and 'next(write) == read' means full.
+    /// Indexes are in the range [0, reserved).
+    //*************************************************************************
+
+    //*************************************************************************
+    /// Calculate the next index.
+    //*************************************************************************
+    template <typename TSize>
+    TSize next(TSize index, TSize reserved)
+    {
+      ++index;
+
+      if (index == reserved) ETL_UNLIKELY
+      {
+        index = 0;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Calculate the index 'n' items after 'index'.
+    /// Does not overflow, even when 'index + n' is out of range of TSize.
+    //*************************************************************************
+    template <typename TSize>
+    TSize advance(TSize index, TSize n, TSize reserved)
+    {
+      if (n >= TSize(reserved - index))
+      {
+        return TSize(n - TSize(reserved - index));
+      }
+      else
+      {
+        return TSize(index + n);
+      }
+    }
+
+    //*************************************************************************
+    /// The number of used slots between the read and write indexes.
+    //*************************************************************************
+    template <typename TSize>
+    TSize count_used(TSize read_index, TSize write_index, TSize reserved)
+    {
+      if (write_index >= read_index)
+      {
+        return TSize(write_index - read_index);
+      }
+      else
+      {
+        return TSize(reserved - read_index + write_index);
+      }
+    }
+
+    //*************************************************************************
+    /// The number of free slots between the write and read indexes.
+    //*************************************************************************
+    template <typename TSize>
+    TSize count_free(TSize write_index, TSize read_index, TSize reserved)
+    {
+      return TSize(reserved - count_used(read_index, write_index, reserved) - 1);
+    }
+  } // namespace private_ring_index
+} // namespace etl
+
+#endif
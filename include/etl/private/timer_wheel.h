@@ -0,0 +1,335 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_WHEEL_INCLUDED
+#define ETL_TIMER_WHEEL_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../bit.h"
+#include "../integral_limits.h"
+#include "../static_assert.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+
+#if ETL_USING_64BIT_TYPES
+namespace etl
+{
+  namespace private_timer_wheel
+  {
+    enum
+    {
+      No_Slot = 0xFFFFU ///< The slot of an inactive timer.
+    };
+
+    //*************************************************************************
+    /// A hierarchical timing wheel, shared by the timing wheel timers.
+    /// Each level has 64 slots, and each slot covers 64 times the period of a
+    /// slot on the level below. A timer is held on the level of the highest
+    /// bit in which its expiry time differs from the current time, in the slot
+    /// selected by its expiry time's bits for that level. When the current
+    /// time reaches the start of a slot on a higher level, the slot's timers
+    /// are moved down to the finer levels. A bitmap of the occupied slots of
+    /// each level finds the next slot without visiting the empty ones.
+    /// The slots are circular doubly linked lists of timer ids, so timers may
+    /// be added to either end, or removed, in constant time.
+    /// TTimer must have the members 'expiry', 'slot', 'previous' and 'next',
+    /// and 'set_inactive()', which sets 'slot' to No_Slot. The largest value of TId is used as 'no timer'.
+    //*************************************************************************
+    template <typename TTimer, typename TId>
+    class wheel
+    {
+    public:
+
+      ETL_STATIC_ASSERT(etl::is_unsigned<TId>::value, "The timer id type must be unsigned");
+
+      typedef TTimer timer_type;
+      typedef TId    id_type;
+
+      static ETL_CONSTANT id_type NO_TIMER = etl::integral_limits<id_type>::max;
+
+      enum
+      {
+        Level_Bits  = 6U,
+        Level_Slots = 64U,
+        Levels      = 6U, // Covers the largest period of 2^32 - 2.
+        Slots       = Level_Slots * Levels,
+        No_Slot     = etl::private_timer_wheel::No_Slot
+      };
+
+      //*******************************
+      wheel(timer_type* ptimers_)
+        : current_time(0U)
+        , ptimers(ptimers_)
+      {
+        clear();
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        for (uint_least8_t level = 0U; level < Levels; ++level)
+        {
+          if (occupied[level] != 0U)
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+      //*******************************
+      uint64_t now() const
+      {
+        return current_time;
+      }
+
+      //*******************************
+      void set_now(uint64_t time)
+      {
+        current_time = time;
+      }
+
+      //*******************************
+      static uint_least8_t level_of(uint_least16_t slot)
+      {
+        return static_cast<uint_least8_t>(slot / Level_Slots);
+      }
+
+      //*******************************
+      // Adds the timer to the front of the slot for its expiry time.
+      //*******************************
+      void insert(id_type id_)
+      {
+        timer_type& timer = ptimers[id_];
+
+        timer.slot = slot_for(timer.expiry);
+        link(id_, true);
+      }
+
+      //*******************************
+      void remove(id_type id_)
+      {
+        timer_type& timer = ptimers[id_];
+
+        const uint_least16_t slot = timer.slot;
+
+        if (timer.next == id_)
+        {
+          // The only timer in the slot.
+          heads[slot] = NO_TIMER;
+          occupied[level_of(slot)] &= ~(uint64_t(1U) << (slot % Level_Slots));
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+          ptimers[timer.next].previous = timer.previous;
+
+          if (heads[slot] == id_)
+          {
+            heads[slot] = timer.next;
+          }
+        }
+
+        timer.previous = NO_TIMER;
+        timer.next     = NO_TIMER;
+        timer.set_inactive();
+      }
+
+      //*******************************
+      id_type front(uint_least16_t slot) const
+      {
+        return heads[slot];
+      }
+
+      //*******************************
+      // Finds the occupied slot that is reached first, and the time that it
+      // is reached. The slots on a level are only reached after those on the
+      // levels below.
+      //*******************************
+      uint_least16_t next_slot(uint64_t& time) const
+      {
+        for (uint_least8_t level = 0U; level < Levels; ++level)
+        {
+          if (occupied[level] != 0U)
+          {
+            const uint_least8_t index = static_cast<uint_least8_t>(etl::countr_zero(occupied[level]));
+            const uint_least8_t shift = static_cast<uint_least8_t>(level * Level_Bits);
+
+            // The current time's higher levels, this level's slot, and zero for the lower levels.
+            time = ((current_time >> (shift + Level_Bits)) << (shift + Level_Bits)) | (uint64_t(index) << shift);
+
+            return static_cast<uint_least16_t>((level * Level_Slots) + index);
+          }
+        }
+
+        return No_Slot;
+      }
+
+      //*******************************
+      // Moves the timers in a higher level slot, that has been reached, to the
+      // finer levels, keeping their order.
+      //*******************************
+      void cascade(uint_least16_t slot)
+      {
+        while (heads[slot] != NO_TIMER)
+        {
+          const id_type id = heads[slot];
+
+          remove(id);
+
+          ptimers[id].slot = slot_for(ptimers[id].expiry);
+          link(id, false);
+        }
+      }
+
+      //*******************************
+      // Returns the earliest expiry time of the timers in a slot.
+      //*******************************
+      uint64_t earliest_expiry(uint_least16_t slot) const
+      {
+        id_type  id     = heads[slot];
+        uint64_t expiry = ptimers[id].expiry;
+
+        id = ptimers[id].next;
+
+        while (id != heads[slot])
+        {
+          expiry = etl::min(expiry, ptimers[id].expiry);
+          id     = ptimers[id].next;
+        }
+
+        return expiry;
+      }
+
+      //*******************************
+      // Returns the time to the next timer event, or 'no_active_interval' if
+      // there is no active timer.
+      //*******************************
+      uint32_t time_to_next(uint32_t no_active_interval) const
+      {
+        uint32_t delta = no_active_interval;
+
+        uint64_t             event_time;
+        const uint_least16_t slot = next_slot(event_time);
+
+        if (slot != No_Slot)
+        {
+          if (level_of(slot) != 0U)
+          {
+            // The slot's timers are due at different times.
+            event_time = earliest_expiry(slot);
+          }
+
+          delta = static_cast<uint32_t>(event_time - current_time);
+        }
+
+        return delta;
+      }
+
+      //*******************************
+      void clear()
+      {
+        for (uint_least16_t i = 0U; i < Slots; ++i)
+        {
+          heads[i] = NO_TIMER;
+        }
+
+        for (uint_least8_t level = 0U; level < Levels; ++level)
+        {
+          occupied[level] = 0U;
+        }
+      }
+
+    private:
+
+      //*******************************
+      // Returns the slot for an expiry time, which must not be before the
+      // current time.
+      //*******************************
+      uint_least16_t slot_for(uint64_t expiry) const
+      {
+        const uint64_t difference = expiry ^ current_time;
+
+        const uint_least8_t level = (difference < Level_Slots) ? 0U : static_cast<uint_least8_t>((etl::bit_width(difference) - 1U) / Level_Bits);
+        const uint_least8_t index = static_cast<uint_least8_t>((expiry >> (level * Level_Bits)) % Level_Slots);
+
+        return static_cast<uint_least16_t>((level * Level_Slots) + index);
+      }
+
+      //*******************************
+      // Links the timer into its slot, at the front or the back.
+      //*******************************
+      void link(id_type id_, bool at_front)
+      {
+        timer_type& timer = ptimers[id_];
+
+        const uint_least16_t slot = timer.slot;
+        const id_type        head = heads[slot];
+
+        if (head == NO_TIMER)
+        {
+          timer.previous = id_;
+          timer.next     = id_;
+          heads[slot]    = id_;
+          occupied[level_of(slot)] |= (uint64_t(1U) << (slot % Level_Slots));
+        }
+        else
+        {
+          timer_type& first = ptimers[head];
+
+          timer.previous               = first.previous;
+          timer.next                   = head;
+          ptimers[first.previous].next = id_;
+          first.previous               = id_;
+
+          if (at_front)
+          {
+            heads[slot] = id_;
+          }
+        }
+      }
+
+      id_type  heads[Slots];     ///< The first timer in each slot.
+      uint64_t occupied[Levels]; ///< A bit for each occupied slot.
+      uint64_t current_time;     ///< The time since the wheel was created.
+
+      timer_type* const ptimers;
+    };
+
+    template <typename TTimer, typename TId>
+    ETL_CONSTANT typename wheel<TTimer, TId>::id_type wheel<TTimer, TId>::NO_TIMER;
+  } // namespace private_timer_wheel
+} // namespace etl
+#endif
+
+#endif
@@ -0,0 +1,623 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "integral_limits.h"
+#include "memory_model.h"
+#include "placement_new.h"
+#include "power.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// The common base for all queue_mpmc_atomic.
+  //***************************************************************************
+  template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<Memory_Model>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == Max_Size;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      // Read the dequeue position first, as it can never overtake the enqueue position.
+      size_type read_position  = dequeue_position.load(etl::memory_order_acquire);
+      size_type write_position = enqueue_position.load(etl::memory_order_acquire);
+
+      size_type n = static_cast<size_type>(write_position - read_position);
+
+      return (n > Max_Size) ? Max_Size : n;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return Max_Size - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Max_Size;
+    }
+
+  protected:
+
+    /// The signed type used to compare sequence numbers.
+    typedef typename etl::make_signed<size_type>::type difference_type;
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : Max_Size(max_size_)
+      , Mask(size_type(max_size_ - 1))
+      , enqueue_position(0)
+      , dequeue_position(0)
+    {
+    }
+
+    //*************************************************************************
+    /// The distance from 'position' to 'sequence'.
+    /// Positions and sequences wrap, so the difference must be calculated
+    /// in the unsigned type before being converted to signed.
+    //*************************************************************************
+    static difference_type get_distance(size_type sequence, size_type position)
+    {
+      return static_cast<difference_type>(static_cast<size_type>(sequence - position));
+    }
+
+    // The enqueue and dequeue positions are optionally separated by a cache
+    // line to stop producers and consumers invalidating each other's cache.
+    const size_type        Max_Size;         ///< The maximum number of items in the queue.
+    const size_type        Mask;             ///< Converts a position to an index.
+  #if defined(ETL_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION)
+    char                   padding_max_size[ETL_CACHE_LINE_SIZE];
+  #endif
+    etl::atomic<size_type> enqueue_position; ///< The position of the next push.
+  #if defined(ETL_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION)
+    char                   padding_enqueue[ETL_CACHE_LINE_SIZE];
+  #endif
+    etl::atomic<size_type> dequeue_position; ///< The position of the next pop.
+  #if defined(ETL_QUEUE_MPMC_ATOMIC_CACHE_LINE_ISOLATION)
+    char                   padding_dequeue[ETL_CACHE_LINE_SIZE];
+  #endif
+
+  private:
+
+      //*************************************************************************
+      /// Destructor.
+      //*************************************************************************
+  #if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~queue_mpmc_atomic_base() {}
+  #else
+
+  protected:
+
+    ~queue_mpmc_atomic_base() {}
+  #endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived
+  /// queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 16> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports lock free concurrent access by multiple producers and
+  /// multiple consumers.
+  /// Each slot has a sequence number that tells producers and consumers whether
+  /// the slot is free or holds an item for the current position.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<Memory_Model>
+  {
+  private:
+
+    typedef typename etl::queue_mpmc_atomic_base<Memory_Model> base_t;
+
+  public:
+
+    typedef T        value_type;      ///< The type stored in the queue.
+    typedef T&       reference;       ///< A reference to the type used in the queue.
+    typedef const T& const_reference; ///< A const reference to the type used in the queue.
+  #if ETL_USING_CPP11
+    typedef T&& rvalue_reference; ///< An rvalue_reference to the type used in the queue.
+  #endif
+    typedef typename base_t::size_type size_type; ///< The type used for determining the size of the queue.
+
+  protected:
+
+    typedef typename base_t::difference_type difference_type;
+
+    //*************************************************************************
+    /// A slot in the queue.
+    //*************************************************************************
+    struct slot_t
+    {
+      etl::atomic<size_type>                                                      sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+    using base_t::dequeue_position;
+    using base_t::enqueue_position;
+    using base_t::get_distance;
+    using base_t::Mask;
+    using base_t::Max_Size;
+
+  public:
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type position;
+      slot_t*   p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value);
+        p_slot->sequence.store(size_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_type position;
+      slot_t*   p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(etl::move(value));
+        p_slot->sequence.store(size_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+  #endif
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename... Args>
+    bool emplace(Args&&... args)
+    {
+      size_type position;
+      slot_t*   p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(etl::forward<Args>(args)...);
+        p_slot->sequence.store(size_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+  #else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    bool emplace()
+    {
+      size_type position;
+      slot_t*   p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T();
+        p_slot->sequence.store(size_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_type position;
+      slot_t*   p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1);
+        p_slot->sequence.store(size_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_type position;
+      slot_t*   p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2);
+        p_slot->sequence.store(size_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_type position;
+      slot_t*   p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2, value3);
+        p_slot->sequence.store(size_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_type position;
+      slot_t*   p_slot = claim_push_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2, value3, value4);
+        p_slot->sequence.store(size_type(position + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+  #endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type position;
+      slot_t*   p_slot = claim_pop_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        T& item = *reinterpret_cast<T*>(&p_slot->value);
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        value = etl::move(item);
+  #else
+        value = item;
+  #endif
+
+        item.~T();
+        p_slot->sequence.store(size_type(position + Mask + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type position;
+      slot_t*   p_slot = claim_pop_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        reinterpret_cast<T*>(&p_slot->value)->~T();
+        p_slot->sequence.store(size_type(position + Mask + 1), etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Items pushed concurrently with the clear may remain in the queue.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(slot_t* p_slots_, size_type max_size_)
+      : base_t(max_size_)
+      , p_slots(p_slots_)
+    {
+    }
+
+    //*************************************************************************
+    /// Initialises the slot sequence numbers.
+    /// Must be called after the slots have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < Max_Size; ++i)
+      {
+        p_slots[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+
+      enqueue_position.store(0, etl::memory_order_relaxed);
+      dequeue_position.store(0, etl::memory_order_release);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims the slot for the next push.
+    /// Returns ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    slot_t* claim_push_slot(size_type& position)
+    {
+      position = enqueue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_t*         p_slot   = &p_slots[position & Mask];
+        size_type       sequence = p_slot->sequence.load(etl::memory_order_acquire);
+        difference_type distance = get_distance(sequence, position);
+
+        if (distance == 0)
+        {
+          // The slot is free for this position.
+          if (enqueue_position.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed))
+          {
+            return p_slot;
+          }
+        }
+        else if (distance < 0)
+        {
+          // The slot still holds an item from the previous lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another producer has claimed this position.
+          position = enqueue_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Claims the slot for the next pop.
+    /// Returns ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    slot_t* claim_pop_slot(size_type& position)
+    {
+      position = dequeue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_t*         p_slot   = &p_slots[position & Mask];
+        size_type       sequence = p_slot->sequence.load(etl::memory_order_acquire);
+        difference_type distance = get_distance(sequence, size_type(position + 1));
+
+        if (distance == 0)
+        {
+          // The slot holds an item for this position.
+          if (dequeue_position.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed))
+          {
+            return p_slot;
+          }
+        }
+        else if (distance < 0)
+        {
+          // The slot has not been written for this position.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another consumer has claimed this position.
+          position = dequeue_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator=(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+  #if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&)            = delete;
+    iqueue_mpmc_atomic& operator=(iqueue_mpmc_atomic&&) = delete;
+  #endif
+
+    slot_t* p_slots; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// A fixed capacity lock free mpmc queue.
+  /// This queue supports concurrent access by multiple producers and multiple
+  /// consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam Size         The maximum capacity of the queue. Must be a power of 2.
+  /// \tparam Memory_Model The memory model for the queue. Determines the type
+  /// of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t Size, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public iqueue_mpmc_atomic<T, Memory_Model>
+  {
+  private:
+
+    typedef typename etl::iqueue_mpmc_atomic<T, Memory_Model> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT((Size > 0U) && etl::is_power_of_2<Size>::value, "Size must be a power of 2");
+    ETL_STATIC_ASSERT((Size <= ((etl::integral_limits<size_type>::max / 2U) + 1U)), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(Size);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(slots, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    /// The slots used in the queue_mpmc_atomic.
+    typename base_t::slot_t slots[MAX_SIZE];
+  };
+
+  template <typename T, size_t Size, const size_t Memory_Model>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, Size, Memory_Model>::size_type queue_mpmc_atomic<T, Size, Memory_Model>::MAX_SIZE;
+} // namespace etl
+
+#endif
+
+#endif
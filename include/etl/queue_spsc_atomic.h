@@ -33,19 +33,54 @@ SOFTWARE.
 
 #include "platform.h"
 #include "alignment.h"
+#include "algorithm.h"
 #include "atomic.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
 #include "integral_limits.h"
+#include "memory.h"
 #include "memory_model.h"
 #include "parameter_type.h"
 #include "placement_new.h"
+#include "span.h"
 #include "utility.h"
 
+#include "private/atomic_wait.h"
+#include "private/ring_index.h"
+
 #include <stddef.h>
 
 #if ETL_HAS_ATOMIC
 
 namespace etl
 {
+  //***************************************************************************
+  /// Base exception for a queue_spsc_atomic.
+  //***************************************************************************
+  class queue_spsc_atomic_exception : public etl::exception
+  {
+  public:
+
+    queue_spsc_atomic_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for committing or releasing more items than are available.
+  //***************************************************************************
+  class queue_spsc_atomic_commit_invalid : public etl::queue_spsc_atomic_exception
+  {
+  public:
+
+    queue_spsc_atomic_commit_invalid(string_type file_name_, numeric_type line_number_)
+      : queue_spsc_atomic_exception(ETL_ERROR_TEXT("queue_spsc_atomic:commit", ETL_QUEUE_SPSC_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
   template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
   class queue_spsc_atomic_base
   {
@@ -85,18 +120,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_acquire);
       size_type read_index  = read.load(etl::memory_order_acquire);
 
-      size_type n;
-
-      if (write_index >= read_index)
-      {
-        n = write_index - read_index;
-      }
-      else
-      {
-        n = Reserved - read_index + write_index;
-      }
-
-      return n;
+      return count_used(read_index, write_index);
     }
 
     //*************************************************************************
@@ -127,9 +151,17 @@ namespace etl
   protected:
 
     queue_spsc_atomic_base(size_type reserved_)
-      : write(0)
+      : Reserved(reserved_)
+      , write(0)
+      , read_cache(0)
+  #if ETL_HAS_ATOMIC_WAIT
+      , write_waiting(false)
+  #endif
       , read(0)
-      , Reserved(reserved_)
+      , write_cache(0)
+  #if ETL_HAS_ATOMIC_WAIT
+      , read_waiting(false)
+  #endif
     {
     }
 
@@ -138,19 +170,203 @@ namespace etl
     //*************************************************************************
     static size_type get_next_index(size_type index, size_type maximum)
     {
-      ++index;
+      return etl::private_ring_index::next(index, maximum);
+    }
+
+    //*************************************************************************
+    /// Calculate the index 'n' items after 'index'.
+    //*************************************************************************
+    static size_type advance_index(size_type index, size_type n, size_type maximum)
+    {
+      return etl::private_ring_index::advance(index, n, maximum);
+    }
+
+    //*************************************************************************
+    /// How many items may be written from 'write_index'?
+    /// Must only be called from the 'push' thread.
+    /// The shared read index is only loaded if the cached copy indicates that
+    /// fewer than 'wanted' items may be written.
+    //*************************************************************************
+    size_type get_write_available(size_type write_index, size_type wanted)
+    {
+      size_type n = count_free(write_index, read_cache);
 
-      if (index == maximum) ETL_UNLIKELY
+      if (n < wanted)
       {
-        index = 0;
+        read_cache = read.load(etl::memory_order_acquire);
+        n          = count_free(write_index, read_cache);
       }
 
-      return index;
+      return n;
     }
 
-    etl::atomic<size_type> write;    ///< Where to input new data.
-    etl::atomic<size_type> read;     ///< Where to get the oldest data.
-    const size_type        Reserved; ///< The maximum number of items in the queue.
+    //*************************************************************************
+    /// How many items may be read from 'read_index'?
+    /// Must only be called from the 'pop' thread.
+    /// The shared write index is only loaded if the cached copy indicates that
+    /// fewer than 'wanted' items may be read.
+    //*************************************************************************
+    size_type get_read_available(size_type read_index, size_type wanted)
+    {
+      size_type n = count_used(read_index, write_cache);
+
+      if (n < wanted)
+      {
+        write_cache = write.load(etl::memory_order_acquire);
+        n           = count_used(read_index, write_cache);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Can the value at 'next_index' be written?
+    /// Must only be called from the 'push' thread.
+    /// The shared read index is only loaded when the cached copy indicates
+    /// that the queue may be full.
+    //*************************************************************************
+    bool can_write(size_type next_index)
+    {
+      if (next_index == read_cache)
+      {
+        read_cache = read.load(etl::memory_order_acquire);
+      }
+
+      return (next_index != read_cache);
+    }
+
+    //*************************************************************************
+    /// Can the value at 'read_index' be read?
+    /// Must only be called from the 'pop' thread.
+    /// The shared write index is only loaded when the cached copy indicates
+    /// that the queue may be empty.
+    //*************************************************************************
+    bool can_read(size_type read_index)
+    {
+      if (read_index == write_cache)
+      {
+        write_cache = write.load(etl::memory_order_acquire);
+      }
+
+      return (read_index != write_cache);
+    }
+
+    //*************************************************************************
+    /// Resets the indexes.
+    /// Must only be called when there is no possibility of concurrent access.
+    //*************************************************************************
+    void reset_indexes()
+    {
+      write       = 0;
+      read_cache  = 0;
+      read        = 0;
+      write_cache = 0;
+
+      notify_write();
+      notify_read();
+    }
+
+    //*************************************************************************
+    /// Publishes a new write index and wakes a consumer waiting in pop_wait.
+    //*************************************************************************
+    void publish_write(size_type write_index)
+    {
+      write.store(write_index, etl::memory_order_release);
+      notify_write();
+    }
+
+    //*************************************************************************
+    /// Publishes a new read index and wakes a producer waiting in push_wait.
+    //*************************************************************************
+    void publish_read(size_type read_index)
+    {
+      read.store(read_index, etl::memory_order_release);
+      notify_read();
+    }
+
+    //*************************************************************************
+    /// Wakes a consumer blocked in pop_wait, if there is one.
+    //*************************************************************************
+    void notify_write()
+    {
+  #if ETL_HAS_ATOMIC_WAIT
+      etl::private_atomic_wait::notify(write, write_waiting);
+  #endif
+    }
+
+    //*************************************************************************
+    /// Wakes a producer blocked in push_wait, if there is one.
+    //*************************************************************************
+    void notify_read()
+    {
+  #if ETL_HAS_ATOMIC_WAIT
+      etl::private_atomic_wait::notify(read, read_waiting);
+  #endif
+    }
+
+    //*************************************************************************
+    /// Waits while 'write' equals 'write_index'.
+    //*************************************************************************
+    void wait_while_write_index(size_type write_index)
+    {
+  #if ETL_HAS_ATOMIC_WAIT
+      etl::private_atomic_wait::wait_while_equal(write, write_index, write_waiting);
+  #else
+      etl::private_atomic_wait::wait_while_equal(write, write_index);
+  #endif
+    }
+
+    //*************************************************************************
+    /// Waits while 'read' equals 'read_index'.
+    //*************************************************************************
+    void wait_while_read_index(size_type read_index)
+    {
+  #if ETL_HAS_ATOMIC_WAIT
+      etl::private_atomic_wait::wait_while_equal(read, read_index, read_waiting);
+  #else
+      etl::private_atomic_wait::wait_while_equal(read, read_index);
+  #endif
+    }
+
+    //*************************************************************************
+    /// The number of free slots between the write and read indexes.
+    //*************************************************************************
+    size_type count_free(size_type write_index, size_type read_index) const
+    {
+      return etl::private_ring_index::count_free(write_index, read_index, Reserved);
+    }
+
+    //*************************************************************************
+    /// The number of used slots between the read and write indexes.
+    //*************************************************************************
+    size_type count_used(size_type read_index, size_type write_index) const
+    {
+      return etl::private_ring_index::count_used(read_index, write_index, Reserved);
+    }
+
+    // The producer's and consumer's data are optionally separated by a cache
+    // line to stop the two threads invalidating each other's cache on every
+    // push or pop.
+    const size_type        Reserved;    ///< The maximum number of items in the queue.
+  #if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION)
+    char                   padding_reserved[ETL_CACHE_LINE_SIZE];
+  #endif
+    etl::atomic<size_type> write;       ///< Where to input new data.
+    size_type              read_cache;  ///< The 'push' thread's copy of 'read'.
+  #if ETL_HAS_ATOMIC_WAIT
+    etl::atomic<bool>      write_waiting; ///< Set while the 'pop' thread is blocked on 'write'. Read on every push.
+  #endif
+  #if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION)
+    char                   padding_write[ETL_CACHE_LINE_SIZE];
+  #endif
+    etl::atomic<size_type> read;        ///< Where to get the oldest data.
+    size_type              write_cache; ///< The 'pop' thread's copy of 'write'.
+  #if ETL_HAS_ATOMIC_WAIT
+    etl::atomic<bool>      read_waiting; ///< Set while the 'push' thread is blocked on 'read'. Read on every pop.
+  #endif
+  #if defined(ETL_QUEUE_SPSC_ATOMIC_CACHE_LINE_ISOLATION)
+    char                   padding_read[ETL_CACHE_LINE_SIZE];
+  #endif
 
   private:
 
@@ -198,7 +414,45 @@ namespace etl
   #endif
     typedef typename base_t::size_type size_type; ///< The type used for determining the size of the queue.
 
+    //*************************************************************************
+    /// A region of the queue's buffer.
+    /// 'second' is only non-empty when the region wraps around the end of the
+    /// buffer.
+    //*************************************************************************
+    struct region_type
+    {
+      region_type(etl::span<T> first_, etl::span<T> second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      /// The total number of items in the region.
+      size_t size() const
+      {
+        return first.size() + second.size();
+      }
+
+      /// Is the region empty?
+      bool empty() const
+      {
+        return size() == 0U;
+      }
+
+      etl::span<T> first;  ///< The part of the region starting at the current index.
+      etl::span<T> second; ///< The part of the region that has wrapped to the start of the buffer.
+    };
+
+    using base_t::advance_index;
+    using base_t::can_read;
+    using base_t::can_write;
     using base_t::get_next_index;
+    using base_t::get_read_available;
+    using base_t::get_write_available;
+    using base_t::publish_read;
+    using base_t::publish_write;
+    using base_t::wait_while_read_index;
+    using base_t::wait_while_write_index;
     using base_t::read;
     using base_t::Reserved;
     using base_t::write;
@@ -211,11 +465,11 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
-        write.store(next_index, etl::memory_order_release);
+        publish_write(next_index);
 
         return true;
       }
@@ -233,11 +487,11 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
-        write.store(next_index, etl::memory_order_release);
+        publish_write(next_index);
 
         return true;
       }
@@ -259,11 +513,11 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
-        write.store(next_index, etl::memory_order_release);
+        publish_write(next_index);
 
         return true;
       }
@@ -282,11 +536,11 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T();
 
-        write.store(next_index, etl::memory_order_release);
+        publish_write(next_index);
 
         return true;
       }
@@ -306,11 +560,11 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
-        write.store(next_index, etl::memory_order_release);
+        publish_write(next_index);
 
         return true;
       }
@@ -330,11 +584,11 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
-        write.store(next_index, etl::memory_order_release);
+        publish_write(next_index);
 
         return true;
       }
@@ -354,11 +608,11 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
-        write.store(next_index, etl::memory_order_release);
+        publish_write(next_index);
 
         return true;
       }
@@ -378,11 +632,11 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
-        write.store(next_index, etl::memory_order_release);
+        publish_write(next_index);
 
         return true;
       }
@@ -399,7 +653,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_read(read_index))
       {
         // Queue is empty
         return false;
@@ -417,7 +671,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_read(read_index))
       {
         // Queue is empty
         return false;
@@ -433,7 +687,7 @@ namespace etl
 
       p_buffer[read_index].~T();
 
-      read.store(next_index, etl::memory_order_release);
+      publish_read(next_index);
 
       return true;
     }
@@ -445,7 +699,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_read(read_index))
       {
         // Queue is empty
         return false;
@@ -455,11 +709,227 @@ namespace etl
 
       p_buffer[read_index].~T();
 
-      read.store(next_index, etl::memory_order_release);
+      publish_read(next_index);
 
       return true;
     }
 
+    //*************************************************************************
+    /// Push a value to the queue, waiting until there is space.
+    /// Spins, then blocks until the consumer pops.
+    /// Must only be called from the 'push' thread.
+    //*************************************************************************
+    void push_wait(const_reference value)
+    {
+      while (!push(value))
+      {
+        wait_while_full();
+      }
+    }
+
+  #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the queue, waiting until there is space.
+    /// Spins, then blocks until the consumer pops.
+    /// Must only be called from the 'push' thread.
+    //*************************************************************************
+    void push_wait(rvalue_reference value)
+    {
+      while (!push(etl::move(value)))
+      {
+        wait_while_full();
+      }
+    }
+  #endif
+
+    //*************************************************************************
+    /// Pop a value from the queue, waiting until one is available.
+    /// Spins, then blocks until the producer pushes.
+    /// Must only be called from the 'pop' thread.
+    //*************************************************************************
+    void pop_wait(reference value)
+    {
+      while (!pop(value))
+      {
+        wait_while_empty();
+      }
+    }
+
+  #if ETL_USING_CPP11
+    //*************************************************************************
+    /// Push a value to the queue, waiting until there is space or 'deadline'
+    /// has passed.
+    /// Must only be called from the 'push' thread.
+    /// Returns false if the deadline passed.
+    //*************************************************************************
+    template <typename TClock, typename TDuration>
+    bool push_wait_until(const_reference value, const etl::chrono::time_point<TClock, TDuration>& deadline)
+    {
+      while (!push(value))
+      {
+        if (!wait_while_full_until(deadline))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Push a value to the queue, waiting until there is space or 'timeout'
+    /// has elapsed on etl::chrono::steady_clock.
+    /// Must only be called from the 'push' thread.
+    /// Returns false if the timeout elapsed.
+    //*************************************************************************
+    template <typename TRep, typename TPeriod>
+    bool push_wait_for(const_reference value, const etl::chrono::duration<TRep, TPeriod>& timeout)
+    {
+      return push_wait_until(value, etl::chrono::steady_clock::now() + timeout);
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue, waiting until one is available or
+    /// 'deadline' has passed.
+    /// Must only be called from the 'pop' thread.
+    /// Returns false if the deadline passed.
+    //*************************************************************************
+    template <typename TClock, typename TDuration>
+    bool pop_wait_until(reference value, const etl::chrono::time_point<TClock, TDuration>& deadline)
+    {
+      while (!pop(value))
+      {
+        if (!wait_while_empty_until(deadline))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue, waiting until one is available or 'timeout'
+    /// has elapsed on etl::chrono::steady_clock.
+    /// Must only be called from the 'pop' thread.
+    /// Returns false if the timeout elapsed.
+    //*************************************************************************
+    template <typename TRep, typename TPeriod>
+    bool pop_wait_for(reference value, const etl::chrono::duration<TRep, TPeriod>& timeout)
+    {
+      return pop_wait_until(value, etl::chrono::steady_clock::now() + timeout);
+    }
+  #endif
+
+    //*************************************************************************
+    /// Push values to the queue.
+    /// Pushes as many values as there is free space for and publishes them
+    /// with a single update of the write index.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    size_type push(etl::span<const T> values)
+    {
+      region_type region = write_reserve(static_cast<size_type>(etl::min(values.size(), size_t(etl::integral_limits<size_type>::max))));
+
+      const T* p_value = values.data();
+
+      etl::uninitialized_copy(p_value, p_value + region.first.size(), region.first.data());
+      p_value += region.first.size();
+      etl::uninitialized_copy(p_value, p_value + region.second.size(), region.second.data());
+
+      size_type n = static_cast<size_type>(region.size());
+
+      write_commit(n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop values from the queue.
+    /// Pops as many values as are available, up to the size of 'values', and
+    /// releases them with a single update of the read index.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    size_type pop(etl::span<T> values)
+    {
+      region_type region = read_acquire(static_cast<size_type>(etl::min(values.size(), size_t(etl::integral_limits<size_type>::max))));
+
+      T* p_value = values.data();
+
+      p_value = etl::move(region.first.begin(), region.first.end(), p_value);
+      etl::move(region.second.begin(), region.second.end(), p_value);
+
+      size_type n = static_cast<size_type>(region.size());
+
+      read_release(n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Reserves the free space in the queue for writing, up to
+    /// 'max_reserve_size' items.
+    /// The items in the region are uninitialised. Each must be constructed
+    /// before the region is committed with write_commit().
+    /// Must only be called from the 'push' thread.
+    //*************************************************************************
+    region_type write_reserve(size_type max_reserve_size = etl::integral_limits<size_type>::max)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type n           = etl::min(get_write_available(write_index, max_reserve_size), max_reserve_size);
+
+      return make_region(write_index, n);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'n' items of the previously reserved region.
+    /// Must only be called from the 'push' thread.
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::queue_spsc_atomic_commit_invalid if 'n' is larger than the free space.
+    //*************************************************************************
+    void write_commit(size_type n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      ETL_ASSERT_OR_RETURN(n <= get_write_available(write_index, n), ETL_ERROR(queue_spsc_atomic_commit_invalid));
+
+      publish_write(advance_index(write_index, n, Reserved));
+    }
+
+    //*************************************************************************
+    /// Acquires the items in the queue for reading, up to 'max_acquire_size'
+    /// items. The items remain in the queue until released by read_release().
+    /// Must only be called from the 'pop' thread.
+    //*************************************************************************
+    region_type read_acquire(size_type max_acquire_size = etl::integral_limits<size_type>::max)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type n          = etl::min(get_read_available(read_index, max_acquire_size), max_acquire_size);
+
+      return make_region(read_index, n);
+    }
+
+    //*************************************************************************
+    /// Destroys and removes the first 'n' items of the previously acquired region.
+    /// Must only be called from the 'pop' thread.
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::queue_spsc_atomic_commit_invalid if 'n' is larger than the number
+    /// of items in the queue.
+    //*************************************************************************
+    void read_release(size_type n)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      ETL_ASSERT_OR_RETURN(n <= get_read_available(read_index, n), ETL_ERROR(queue_spsc_atomic_commit_invalid));
+
+      region_type region = make_region(read_index, n);
+
+      etl::destroy(region.first.begin(), region.first.end());
+      etl::destroy(region.second.begin(), region.second.end());
+
+      publish_read(advance_index(read_index, n, Reserved));
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     //*************************************************************************
@@ -489,8 +959,7 @@ namespace etl
     {
       if ETL_IF_CONSTEXPR (etl::is_trivially_destructible<T>::value)
       {
-        write = 0;
-        read  = 0;
+        this->reset_indexes();
       }
       else
       {
@@ -514,6 +983,58 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Waits while the queue is full.
+    /// Full while 'read' is the index after 'write'.
+    //*************************************************************************
+    void wait_while_full()
+    {
+      size_type next_index = get_next_index(write.load(etl::memory_order_relaxed), Reserved);
+
+      wait_while_read_index(next_index);
+    }
+
+    //*************************************************************************
+    /// Waits while the queue is empty.
+    /// Empty while 'write' is equal to 'read'.
+    //*************************************************************************
+    void wait_while_empty()
+    {
+      wait_while_write_index(read.load(etl::memory_order_relaxed));
+    }
+
+  #if ETL_USING_CPP11
+    //*************************************************************************
+    /// Waits while the queue is full, until 'deadline'.
+    //*************************************************************************
+    template <typename TClock, typename TDuration>
+    bool wait_while_full_until(const etl::chrono::time_point<TClock, TDuration>& deadline)
+    {
+      size_type next_index = get_next_index(write.load(etl::memory_order_relaxed), Reserved);
+
+      return etl::private_atomic_wait::wait_while_equal_until(read, next_index, deadline);
+    }
+
+    //*************************************************************************
+    /// Waits while the queue is empty, until 'deadline'.
+    //*************************************************************************
+    template <typename TClock, typename TDuration>
+    bool wait_while_empty_until(const etl::chrono::time_point<TClock, TDuration>& deadline)
+    {
+      return etl::private_atomic_wait::wait_while_equal_until(write, read.load(etl::memory_order_relaxed), deadline);
+    }
+  #endif
+
+    //*************************************************************************
+    /// Makes a region of 'n' items starting at 'index'.
+    //*************************************************************************
+    region_type make_region(size_type index, size_type n) const
+    {
+      size_type first_size = etl::min(n, size_type(Reserved - index));
+
+      return region_type(etl::span<T>(p_buffer + index, first_size), etl::span<T>(p_buffer, size_type(n - first_size)));
+    }
+
     // Disable copy construction and assignment.
     iqueue_spsc_atomic(const iqueue_spsc_atomic&) ETL_DELETE;
     iqueue_spsc_atomic& operator=(const iqueue_spsc_atomic&) ETL_DELETE;
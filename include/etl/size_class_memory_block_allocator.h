@@ -0,0 +1,383 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SIZE_CLASS_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_SIZE_CLASS_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "generic_pool.h"
+#include "imemory_block_allocator.h"
+#include "ipool.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //*************************************************************************
+  /// Describes one size class of an etl::size_class_memory_block_allocator.
+  ///\tparam VBlock_Size The size of each block in the class.
+  ///\tparam VSize       The number of blocks in the class.
+  //*************************************************************************
+  template <size_t VBlock_Size, size_t VSize>
+  struct memory_block_size_class
+  {
+    static ETL_CONSTANT size_t Block_Size = VBlock_Size;
+    static ETL_CONSTANT size_t Size       = VSize;
+  };
+
+  template <size_t VBlock_Size, size_t VSize>
+  ETL_CONSTANT size_t memory_block_size_class<VBlock_Size, VSize>::Block_Size;
+
+  template <size_t VBlock_Size, size_t VSize>
+  ETL_CONSTANT size_t memory_block_size_class<VBlock_Size, VSize>::Size;
+
+  //*************************************************************************
+  /// The base of the size class memory block allocators.
+  /// Each size class is a pool of fixed sized blocks. A request is served by
+  /// the smallest class that it fits, or by the next larger class that has a
+  /// free block if that one is full. If no class can serve it, the request is
+  /// passed to the successor, if there is one.
+  //*************************************************************************
+  class isize_class_memory_block_allocator : public imemory_block_allocator
+  {
+  public:
+
+    //*************************************************************************
+    /// The number of size classes.
+    //*************************************************************************
+    size_t number_of_size_classes() const
+    {
+      return Number_Of_Size_Classes;
+    }
+
+    //*************************************************************************
+    /// The size of the blocks in a size class.
+    /// This may be larger than the requested size, due to alignment.
+    //*************************************************************************
+    size_t block_size(size_t size_class) const
+    {
+      return p_pools[size_class]->max_item_size();
+    }
+
+    //*************************************************************************
+    /// The number of blocks in a size class.
+    //*************************************************************************
+    size_t max_size(size_t size_class) const
+    {
+      return p_pools[size_class]->max_size();
+    }
+
+    //*************************************************************************
+    /// The number of blocks currently allocated from a size class.
+    //*************************************************************************
+    size_t size(size_t size_class) const
+    {
+      return p_pools[size_class]->size();
+    }
+
+    //*************************************************************************
+    /// The highest number of blocks that have been allocated from a size class
+    /// at the same time.
+    //*************************************************************************
+    size_t high_water_mark(size_t size_class) const
+    {
+      return p_high_water_marks[size_class];
+    }
+
+    //*************************************************************************
+    /// The number of requests that best fitted a size class, but that could
+    /// not be served by it because it was full.
+    //*************************************************************************
+    size_t overflow_count(size_t size_class) const
+    {
+      return p_overflow_counts[size_class];
+    }
+
+    //*************************************************************************
+    /// Returns the index of the size class that best fits the size, or
+    /// number_of_size_classes() if there is none.
+    //*************************************************************************
+    size_t find_size_class(size_t required_size) const
+    {
+      size_t size_class = 0U;
+
+      while ((size_class < Number_Of_Size_Classes) && (required_size > block_size(size_class)))
+      {
+        ++size_class;
+      }
+
+      return size_class;
+    }
+
+    //*************************************************************************
+    /// Resets the high water marks to the current sizes, and clears the
+    /// overflow counts.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      for (size_t i = 0U; i < Number_Of_Size_Classes; ++i)
+      {
+        p_high_water_marks[i] = size(i);
+        p_overflow_counts[i]  = 0U;
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    /// The pools must be in order of increasing block size.
+    //*************************************************************************
+    isize_class_memory_block_allocator(etl::ipool** p_pools_, size_t* p_high_water_marks_, size_t* p_overflow_counts_,
+                                       size_t number_of_size_classes_, size_t alignment_)
+      : p_pools(p_pools_)
+      , p_high_water_marks(p_high_water_marks_)
+      , p_overflow_counts(p_overflow_counts_)
+      , Number_Of_Size_Classes(number_of_size_classes_)
+      , Alignment(alignment_)
+    {
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if (required_alignment > Alignment)
+      {
+        return ETL_NULLPTR;
+      }
+
+      const size_t best_size_class = find_size_class(required_size);
+
+      for (size_t size_class = best_size_class; size_class < Number_Of_Size_Classes; ++size_class)
+      {
+        etl::ipool& pool = *p_pools[size_class];
+
+        if (!pool.full())
+        {
+          if (size_class != best_size_class)
+          {
+            ++p_overflow_counts[best_size_class];
+          }
+
+          void* p = pool.allocate<char>();
+
+          p_high_water_marks[size_class] = etl::max(p_high_water_marks[size_class], pool.size());
+
+          return p;
+        }
+      }
+
+      if (best_size_class < Number_Of_Size_Classes)
+      {
+        ++p_overflow_counts[best_size_class];
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      for (size_t size_class = 0U; size_class < Number_Of_Size_Classes; ++size_class)
+      {
+        if (p_pools[size_class]->is_in_pool(pblock))
+        {
+          p_pools[size_class]->release(pblock);
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      for (size_t size_class = 0U; size_class < Number_Of_Size_Classes; ++size_class)
+      {
+        if (p_pools[size_class]->is_in_pool(pblock))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+  private:
+
+    etl::ipool** p_pools;            ///< The pools, in order of increasing block size.
+    size_t*      p_high_water_marks; ///< The high water mark of each pool.
+    size_t*      p_overflow_counts;  ///< The overflow count of each pool.
+
+    const size_t Number_Of_Size_Classes;
+    const size_t Alignment;
+  };
+
+#if ETL_USING_CPP11
+  namespace private_size_class_memory_block_allocator
+  {
+    //*************************************************************************
+    /// Checks that the size classes are in order of increasing block size.
+    //*************************************************************************
+    template <typename... TSizeClasses>
+    struct is_ascending;
+
+    template <typename TSizeClass>
+    struct is_ascending<TSizeClass>
+    {
+      static ETL_CONSTANT bool value = true;
+    };
+
+    template <typename TSizeClass1, typename TSizeClass2, typename... TSizeClasses>
+    struct is_ascending<TSizeClass1, TSizeClass2, TSizeClasses...>
+    {
+      static ETL_CONSTANT bool value = (TSizeClass1::Block_Size < TSizeClass2::Block_Size) && is_ascending<TSizeClass2, TSizeClasses...>::value;
+    };
+
+    //*************************************************************************
+    /// Storage for a pool per size class.
+    //*************************************************************************
+    template <size_t VAlignment, typename... TSizeClasses>
+    class pools;
+
+    template <size_t VAlignment>
+    class pools<VAlignment>
+    {
+    public:
+
+      void get(etl::ipool**) {}
+    };
+
+    template <size_t VAlignment, typename TSizeClass, typename... TSizeClasses>
+    class pools<VAlignment, TSizeClass, TSizeClasses...> : public pools<VAlignment, TSizeClasses...>
+    {
+    public:
+
+      void get(etl::ipool** p_pools)
+      {
+        *p_pools = &pool;
+        pools<VAlignment, TSizeClasses...>::get(p_pools + 1);
+      }
+
+    private:
+
+      etl::generic_pool<TSizeClass::Block_Size, VAlignment, TSizeClass::Size> pool;
+    };
+
+    //*************************************************************************
+    /// Builds the power of two size classes from VBlock_Size up to
+    /// VMax_Block_Size.
+    //*************************************************************************
+    template <bool VDone, size_t VBlock_Size, size_t VMax_Block_Size, size_t VSize, size_t VAlignment, typename... TSizeClasses>
+    struct power_of_two_size_classes;
+  } // namespace private_size_class_memory_block_allocator
+
+  //*************************************************************************
+  /// A memory block allocator with a fixed sized pool for each size class.
+  ///\tparam VAlignment    The alignment of every block.
+  ///\tparam TSizeClasses  The size classes, as etl::memory_block_size_class,
+  ///                      in order of increasing block size.
+  //*************************************************************************
+  template <size_t VAlignment, typename... TSizeClasses>
+  class size_class_memory_block_allocator : public isize_class_memory_block_allocator
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TSizeClasses) > 0U, "There must be at least one size class");
+    ETL_STATIC_ASSERT(private_size_class_memory_block_allocator::is_ascending<TSizeClasses...>::value,
+                      "Size classes must be in order of increasing block size");
+
+    static ETL_CONSTANT size_t Alignment              = VAlignment;
+    static ETL_CONSTANT size_t Number_Of_Size_Classes = sizeof...(TSizeClasses);
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    size_class_memory_block_allocator()
+      : isize_class_memory_block_allocator(p_pools, high_water_marks, overflow_counts, Number_Of_Size_Classes, Alignment)
+      , p_pools()
+      , high_water_marks()
+      , overflow_counts()
+    {
+      storage.get(p_pools);
+    }
+
+  private:
+
+    private_size_class_memory_block_allocator::pools<VAlignment, TSizeClasses...> storage;
+
+    etl::ipool* p_pools[Number_Of_Size_Classes];
+    size_t      high_water_marks[Number_Of_Size_Classes];
+    size_t      overflow_counts[Number_Of_Size_Classes];
+  };
+
+  template <size_t VAlignment, typename... TSizeClasses>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, TSizeClasses...>::Alignment;
+
+  template <size_t VAlignment, typename... TSizeClasses>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VAlignment, TSizeClasses...>::Number_Of_Size_Classes;
+
+  namespace private_size_class_memory_block_allocator
+  {
+    template <size_t VBlock_Size, size_t VMax_Block_Size, size_t VSize, size_t VAlignment, typename... TSizeClasses>
+    struct power_of_two_size_classes<false, VBlock_Size, VMax_Block_Size, VSize, VAlignment, TSizeClasses...>
+    {
+      typedef typename power_of_two_size_classes<((VBlock_Size * 2U) > VMax_Block_Size), VBlock_Size * 2U, VMax_Block_Size, VSize, VAlignment, TSizeClasses...,
+                                                 etl::memory_block_size_class<VBlock_Size, VSize> >::type type;
+    };
+
+    template <size_t VBlock_Size, size_t VMax_Block_Size, size_t VSize, size_t VAlignment, typename... TSizeClasses>
+    struct power_of_two_size_classes<true, VBlock_Size, VMax_Block_Size, VSize, VAlignment, TSizeClasses...>
+    {
+      typedef etl::size_class_memory_block_allocator<VAlignment, TSizeClasses...> type;
+    };
+  } // namespace private_size_class_memory_block_allocator
+
+  //*************************************************************************
+  /// A size class memory block allocator with power of two block sizes from
+  /// VMin_Block_Size to VMax_Block_Size, each with VSize blocks.
+  //*************************************************************************
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VSize, size_t VAlignment>
+  using power_of_two_memory_block_allocator =
+    typename private_size_class_memory_block_allocator::power_of_two_size_classes<(VMin_Block_Size > VMax_Block_Size), VMin_Block_Size, VMax_Block_Size, VSize,
+                                                                                   VAlignment>::type;
+#endif
+} // namespace etl
+
+#endif
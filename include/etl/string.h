@@ -720,8 +720,8 @@ namespace etl
   {
     size_t operator()(const etl::istring& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -730,8 +730,8 @@ namespace etl
   {
     size_t operator()(const etl::string<SIZE>& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -740,8 +740,8 @@ namespace etl
   {
     size_t operator()(const etl::string_ext& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 #endif
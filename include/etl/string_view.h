@@ -952,8 +952,8 @@ namespace etl
   {
     size_t operator()(const etl::string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -962,8 +962,8 @@ namespace etl
   {
     size_t operator()(const etl::wstring_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -972,8 +972,8 @@ namespace etl
   {
     size_t operator()(const etl::u16string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -982,8 +982,8 @@ namespace etl
   {
     size_t operator()(const etl::u32string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 #endif
@@ -701,8 +701,8 @@ namespace etl
   {
     size_t operator()(const etl::iu16string& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -711,8 +711,8 @@ namespace etl
   {
     size_t operator()(const etl::u16string<SIZE>& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -721,8 +721,8 @@ namespace etl
   {
     size_t operator()(const etl::u16string_ext& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 #endif
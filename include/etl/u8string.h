@@ -721,8 +721,8 @@ namespace etl
   {
     size_t operator()(const etl::iu8string& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -731,8 +731,8 @@ namespace etl
   {
     size_t operator()(const etl::u8string<SIZE>& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
 
@@ -741,8 +741,8 @@ namespace etl
   {
     size_t operator()(const etl::u8string_ext& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
-                                                     reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+      return etl::private_hash::string_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                    reinterpret_cast<const uint8_t*>(text.data() + text.size()));
     }
   };
     #include "private/diagnostic_pop.h"
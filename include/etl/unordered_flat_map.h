@@ -0,0 +1,1503 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_MAP_INCLUDED
+#define ETL_UNORDERED_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "debug_count.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "functional.h"
+#include "hash.h"
+#include "initializer_list.h"
+#include "integral_limits.h"
+#include "iterator.h"
+#include "log.h"
+#include "memory.h"
+#include "nth_type.h"
+#include "placement_new.h"
+#include "power.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup unordered_flat_map unordered_flat_map
+/// An open addressing unordered_map with the capacity defined at compile time.
+///\ingroup containers
+//*****************************************************************************
+
+#if !defined(ETL_UNORDERED_FLAT_MAP_MAX_PROBE_LENGTH)
+  /// The furthest that an element may be stored from its home bucket.
+  #define ETL_UNORDERED_FLAT_MAP_MAX_PROBE_LENGTH 32
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_exception : public etl::exception
+  {
+  public:
+
+    unordered_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_full : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:full", ETL_UNORDERED_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Probe limit exception for the unordered_flat_map.
+  /// The map is not full, but the new element would be stored further from
+  /// its home bucket than the maximum probe length.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_probe_limit : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_probe_limit(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:probe limit", ETL_UNORDERED_FLAT_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the unordered_flat_map.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  class unordered_flat_map_out_of_range : public etl::unordered_flat_map_exception
+  {
+  public:
+
+    unordered_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_map_exception(ETL_ERROR_TEXT("unordered_flat_map:range", ETL_UNORDERED_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized unordered_flat_map.
+  /// Can be used as a reference type for all unordered_flat_map containing a
+  /// specific type.
+  /// The elements are stored inline in one array, using Robin Hood open
+  /// addressing. A byte per slot holds the distance of the element from its
+  /// home bucket, so most lookups touch one or two cache lines. Elements are
+  /// kept in order of home bucket, so erasing shifts the following elements
+  /// back rather than leaving tombstones.
+  /// Inserting or erasing an element invalidates iterators to the elements
+  /// after it.
+  /// An element may be no further than max_probe_length() from its home
+  /// bucket, so an insert may fail before the map is full if too many keys
+  /// share nearby home buckets. This is unlikely unless the hash is poor.
+  /// It is reported as unordered_flat_map_probe_limit, rather than
+  /// unordered_flat_map_full.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iunordered_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&& rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    /// Defines the parameter types
+    typedef const key_type& const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&& rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+  protected:
+
+    /// The storage for one element.
+    typedef typename etl::aligned_storage<sizeof(value_type), etl::alignment_of<value_type>::value>::type slot_t;
+
+    /// The distance of an empty slot.
+    static ETL_CONSTANT uint8_t Empty = 0U;
+
+  public:
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, T>
+    {
+    public:
+
+      typedef typename etl::iterator<ETL_OR_STD::forward_iterator_tag, T>::value_type value_type;
+      typedef typename iunordered_flat_map::key_type                                  key_type;
+      typedef typename iunordered_flat_map::mapped_type                               mapped_type;
+      typedef typename iunordered_flat_map::hasher                                    hasher;
+      typedef typename iunordered_flat_map::key_equal                                 key_equal;
+      typedef typename iunordered_flat_map::reference                                 reference;
+      typedef typename iunordered_flat_map::const_reference                           const_reference;
+      typedef typename iunordered_flat_map::pointer                                   pointer;
+      typedef typename iunordered_flat_map::const_pointer                             const_pointer;
+      typedef typename iunordered_flat_map::size_type                                 size_type;
+
+      friend class iunordered_flat_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : p_distance(ETL_NULLPTR)
+        , p_distance_end(ETL_NULLPTR)
+        , p_slot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : p_distance(other.p_distance)
+        , p_distance_end(other.p_distance_end)
+        , p_slot(other.p_slot)
+      {
+      }
+
+      //*********************************
+      iterator& operator++()
+      {
+        do {
+          ++p_distance;
+          ++p_slot;
+        } while ((p_distance != p_distance_end) && (*p_distance == Empty));
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator=(const iterator& other)
+      {
+        p_distance     = other.p_distance;
+        p_distance_end = other.p_distance_end;
+        p_slot         = other.p_slot;
+        return *this;
+      }
+
+      //*********************************
+      reference operator*() const
+      {
+        return *reinterpret_cast<pointer>(p_slot);
+      }
+
+      //*********************************
+      pointer operator&() const
+      {
+        return reinterpret_cast<pointer>(p_slot);
+      }
+
+      //*********************************
+      pointer operator->() const
+      {
+        return reinterpret_cast<pointer>(p_slot);
+      }
+
+      //*********************************
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_distance == rhs.p_distance;
+      }
+
+      //*********************************
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(uint8_t* p_distance_, uint8_t* p_distance_end_, slot_t* p_slot_)
+        : p_distance(p_distance_)
+        , p_distance_end(p_distance_end_)
+        , p_slot(p_slot_)
+      {
+      }
+
+      uint8_t* p_distance;
+      uint8_t* p_distance_end;
+      slot_t*  p_slot;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const T>
+    {
+    public:
+
+      typedef typename etl::iterator<ETL_OR_STD::forward_iterator_tag, const T>::value_type value_type;
+      typedef typename iunordered_flat_map::key_type                                        key_type;
+      typedef typename iunordered_flat_map::mapped_type                                     mapped_type;
+      typedef typename iunordered_flat_map::hasher                                          hasher;
+      typedef typename iunordered_flat_map::key_equal                                       key_equal;
+      typedef typename iunordered_flat_map::reference                                       reference;
+      typedef typename iunordered_flat_map::const_reference                                 const_reference;
+      typedef typename iunordered_flat_map::pointer                                         pointer;
+      typedef typename iunordered_flat_map::const_pointer                                   const_pointer;
+      typedef typename iunordered_flat_map::size_type                                       size_type;
+
+      friend class iunordered_flat_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : p_distance(ETL_NULLPTR)
+        , p_distance_end(ETL_NULLPTR)
+        , p_slot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iunordered_flat_map::iterator& other)
+        : p_distance(other.p_distance)
+        , p_distance_end(other.p_distance_end)
+        , p_slot(other.p_slot)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : p_distance(other.p_distance)
+        , p_distance_end(other.p_distance_end)
+        , p_slot(other.p_slot)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator++()
+      {
+        do {
+          ++p_distance;
+          ++p_slot;
+        } while ((p_distance != p_distance_end) && (*p_distance == Empty));
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator=(const const_iterator& other)
+      {
+        p_distance     = other.p_distance;
+        p_distance_end = other.p_distance_end;
+        p_slot         = other.p_slot;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator*() const
+      {
+        return *reinterpret_cast<const_pointer>(p_slot);
+      }
+
+      //*********************************
+      const_pointer operator&() const
+      {
+        return reinterpret_cast<const_pointer>(p_slot);
+      }
+
+      //*********************************
+      const_pointer operator->() const
+      {
+        return reinterpret_cast<const_pointer>(p_slot);
+      }
+
+      //*********************************
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_distance == rhs.p_distance;
+      }
+
+      //*********************************
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const uint8_t* p_distance_, const uint8_t* p_distance_end_, const slot_t* p_slot_)
+        : p_distance(p_distance_)
+        , p_distance_end(p_distance_end_)
+        , p_slot(p_slot_)
+      {
+      }
+
+      const uint8_t* p_distance;
+      const uint8_t* p_distance_end;
+      const slot_t*  p_slot;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the unordered_flat_map.
+    ///\return An iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return make_iterator(first_occupied());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return make_iterator(first_occupied());
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_map.
+    ///\return A const iterator to the beginning of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return make_iterator(first_occupied());
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the unordered_flat_map.
+    ///\return An iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return make_iterator(Number_Of_Slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return make_iterator(Number_Of_Slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_map.
+    ///\return A const iterator to the end of the unordered_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return make_iterator(Number_Of_Slots);
+    }
+
+    //*********************************************************************
+    /// Returns the number of the buckets the unordered_flat_map holds.
+    /// Each element's home is one of these. Elements may be stored up to the
+    /// probe length past it.
+    ///\return The number of the buckets the unordered_flat_map holds.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return Bucket_Count;
+    }
+
+    //*********************************************************************
+    /// Returns the furthest that an element may be stored from its home bucket.
+    //*********************************************************************
+    size_type max_probe_length() const
+    {
+      return Probe_Length;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_full if the map is full, or an
+    /// etl::unordered_flat_map_probe_limit if a new element would be too far
+    /// from its home bucket.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](const_key_reference key)
+    {
+      const size_t home = home_index(key);
+
+      bool   found;
+      size_t index = locate(key, home, found);
+
+      if (!found)
+      {
+        index = make_room(home, index);
+
+        if (index == Number_Of_Slots)
+        {
+          return begin()->second;
+        }
+
+        ::new (slot_address(index)) value_type(key, mapped_type());
+        occupy_at(home, index);
+      }
+
+      return slot(index).second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_full if the map is full, or an
+    /// etl::unordered_flat_map_probe_limit if a new element would be too far
+    /// from its home bucket.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator[](rvalue_key_reference key)
+    {
+      const size_t home = home_index(key);
+
+      bool   found;
+      size_t index = locate(key, home, found);
+
+      if (!found)
+      {
+        index = make_room(home, index);
+
+        if (index == Number_Of_Slots)
+        {
+          return begin()->second;
+        }
+
+        ::new (slot_address(index)) value_type(etl::move(key), mapped_type());
+        occupy_at(home, index);
+      }
+
+      return slot(index).second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      bool   found;
+      size_t index = locate(key, found);
+
+      ETL_ASSERT(found, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return found ? slot(index).second : begin()->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an
+    /// etl::unordered_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      bool   found;
+      size_t index = locate(key, found);
+
+      ETL_ASSERT(found, ETL_ERROR(unordered_flat_map_out_of_range));
+
+      return found ? slot(index).second : begin()->second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the unordered_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the map is full, or unordered_flat_map_probe_limit if the value would
+    /// be too far from its home bucket.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      const_key_reference key  = key_value_pair.first;
+      const size_t        home = home_index(key);
+
+      bool   found;
+      size_t index = locate(key, home, found);
+
+      if (found)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      index = make_room(home, index);
+
+      if (index == Number_Of_Slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      ::new (slot_address(index)) value_type(key_value_pair);
+      occupy_at(home, index);
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the map is full, or unordered_flat_map_probe_limit if the value would
+    /// be too far from its home bucket.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      const_key_reference key  = key_value_pair.first;
+      const size_t        home = home_index(key);
+
+      bool   found;
+      size_t index = locate(key, home, found);
+
+      if (found)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), false);
+      }
+
+      index = make_room(home, index);
+
+      if (index == Number_Of_Slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      ::new (slot_address(index)) value_type(etl::move(key_value_pair));
+      occupy_at(home, index);
+
+      return ETL_OR_STD::pair<iterator, bool>(make_iterator(index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the map is full, or unordered_flat_map_probe_limit if the value would
+    /// be too far from its home bucket.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the map is full, or unordered_flat_map_probe_limit if the value would
+    /// be too far from its home bucket.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_flat_map.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// a value cannot be inserted.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*********************************************************************
+    /// Emplaces a value to the unordered_flat_map.
+    /// The value is constructed from the arguments before it is hashed.
+    //*********************************************************************
+    template <typename... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(Args&&... args)
+    {
+      return insert(value_type(etl::forward<Args>(args)...));
+    }
+#else
+    //*********************************************************************
+    /// Emplaces a value to the unordered_flat_map.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace(const_reference key_value_pair)
+    {
+      return insert(key_value_pair);
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      bool   found;
+      size_t index = locate(key, found);
+
+      if (found)
+      {
+        erase_at(index);
+        return 1U;
+      }
+
+      return 0U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    /// The following elements in the same run are shifted back, so the
+    /// returned iterator may refer to the same slot.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the element after the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      size_t index = size_t(ielement.p_distance - p_distances);
+
+      erase_at(index);
+
+      // Has the next element been shifted into the erased slot?
+      if (p_distances[index] != Empty)
+      {
+        return make_iterator(index);
+      }
+
+      iterator inext = make_iterator(index);
+      ++inext;
+
+      return inext;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including
+    /// the element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing shifts elements back, so count the elements rather than
+      // compare with 'last'.
+      difference_type n = etl::distance(first_, last_);
+
+      iterator itr = make_iterator(size_t(first_.p_distance - p_distances));
+
+      while (n-- > 0)
+      {
+        itr = erase(itr);
+      }
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      bool   found;
+      size_t index = locate(key, found);
+
+      return found ? make_iterator(index) : end();
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      bool   found;
+      size_t index = locate(key, found);
+
+      return found ? make_iterator(index) : end();
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists,
+    /// otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key
+    /// exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the unordered_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return element_count;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return element_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return element_count == Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - element_count;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator=(const iunordered_flat_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_flat_map& operator=(iunordered_flat_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the unordered_flat_map contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      bool found;
+      locate(key, found);
+
+      return found;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iunordered_flat_map(slot_t* p_slots_, uint8_t* p_distances_, size_t max_size_, size_t bucket_count_, size_t probe_length_, size_t hash_shift_,
+                        hasher key_hash_function_, key_equal key_equal_function_)
+      : p_slots(p_slots_)
+      , p_distances(p_distances_)
+      , element_count(0U)
+      , Max_Size(max_size_)
+      , Bucket_Count(bucket_count_)
+      , Probe_Length(probe_length_)
+      , Number_Of_Slots(bucket_count_ + probe_length_)
+      , Hash_Shift(hash_shift_)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_flat_map.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = 0U; i < Number_Of_Slots; ++i)
+        {
+          if (p_distances[i] != Empty)
+          {
+            slot(i).~value_type();
+            ETL_DECREMENT_DEBUG_COUNT;
+          }
+        }
+      }
+
+      etl::fill_n(p_distances, Number_Of_Slots, uint8_t(Empty));
+      element_count = 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator b, iterator e)
+    {
+      while (b != e)
+      {
+        iterator temp = b;
+        ++temp;
+        insert(etl::move(*b));
+        b = temp;
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// Gets the element in a slot.
+    //*********************************************************************
+    value_type& slot(size_t index)
+    {
+      return *reinterpret_cast<value_type*>(&p_slots[index]);
+    }
+
+    //*********************************************************************
+    /// Gets the element in a slot.
+    //*********************************************************************
+    const value_type& slot(size_t index) const
+    {
+      return *reinterpret_cast<const value_type*>(&p_slots[index]);
+    }
+
+    //*********************************************************************
+    /// Gets the address of a slot.
+    //*********************************************************************
+    void* slot_address(size_t index)
+    {
+      return static_cast<void*>(&p_slots[index]);
+    }
+
+    //*********************************************************************
+    /// Moves the element in one slot to another, empty, slot.
+    //*********************************************************************
+    void move_slot(size_t to, size_t from)
+    {
+#if ETL_USING_CPP11
+      ::new (slot_address(to)) value_type(etl::move(slot(from)));
+#else
+      ::new (slot_address(to)) value_type(slot(from));
+#endif
+      slot(from).~value_type();
+    }
+
+    //*********************************************************************
+    /// Makes an iterator for a slot.
+    //*********************************************************************
+    iterator make_iterator(size_t index)
+    {
+      return iterator(p_distances + index, p_distances + Number_Of_Slots, p_slots + index);
+    }
+
+    //*********************************************************************
+    /// Makes a const_iterator for a slot.
+    //*********************************************************************
+    const_iterator make_iterator(size_t index) const
+    {
+      return const_iterator(p_distances + index, p_distances + Number_Of_Slots, p_slots + index);
+    }
+
+    //*********************************************************************
+    /// Gets the index of the first occupied slot, or Number_Of_Slots.
+    //*********************************************************************
+    size_t first_occupied() const
+    {
+      size_t index = 0U;
+
+      if (!empty())
+      {
+        while (p_distances[index] == Empty)
+        {
+          ++index;
+        }
+
+        return index;
+      }
+
+      return Number_Of_Slots;
+    }
+
+    //*********************************************************************
+    /// Gets the home bucket of a key.
+    /// The hash is multiplied by the golden ratio and the top bits are used,
+    /// so that weak hashes, such as the identity, still spread evenly.
+    //*********************************************************************
+    size_t home_index(const_key_reference key) const
+    {
+#if ETL_USING_64BIT_TYPES
+      const size_t multiplier = (etl::integral_limits<size_t>::bits > 32U) ? size_t(0x9E3779B97F4A7C15ULL) : size_t(0x9E3779B9UL);
+#else
+      const size_t multiplier = size_t(0x9E3779B9UL);
+#endif
+
+      return size_t(size_t(key_hash_function(key)) * multiplier) >> Hash_Shift;
+    }
+
+    //*********************************************************************
+    /// Searches for a key.
+    /// If found, returns the index of the element, otherwise the index that it
+    /// would be inserted at.
+    //*********************************************************************
+    size_t locate(const_key_reference key, bool& found) const
+    {
+      return locate(key, home_index(key), found);
+    }
+
+    //*********************************************************************
+    /// Searches for a key, with its home bucket already calculated.
+    //*********************************************************************
+    size_t locate(const_key_reference key, size_t home, bool& found) const
+    {
+      size_t  index    = home;
+      uint8_t distance = 1U;
+
+      // The elements are in order of home bucket, so the key cannot be after
+      // one that is nearer to its home than the key would be.
+      while ((index < Number_Of_Slots) && (p_distances[index] >= distance))
+      {
+        if ((p_distances[index] == distance) && key_equal_function(slot(index).first, key))
+        {
+          found = true;
+          return index;
+        }
+
+        ++index;
+        ++distance;
+      }
+
+      found = false;
+      return index;
+    }
+
+    //*********************************************************************
+    /// Makes room for a new element with the home bucket 'home' at 'index', by
+    /// shifting the following elements along to the next empty slot.
+    /// Returns 'index', or Number_Of_Slots if there is no room.
+    /// If asserts or exceptions are enabled, emits unordered_flat_map_full if
+    /// the map is full, or unordered_flat_map_probe_limit if an element would
+    /// be too far from its home bucket.
+    //*********************************************************************
+    size_t make_room(size_t home, size_t index)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(unordered_flat_map_full), Number_Of_Slots);
+
+      bool has_room = (index < Number_Of_Slots) && ((index - home) <= Probe_Length);
+
+      // Find the next empty slot, checking that the elements before it can move
+      // one further from their home.
+      size_t empty_index = index;
+
+      while (has_room && (empty_index < Number_Of_Slots) && (p_distances[empty_index] != Empty))
+      {
+        has_room = (p_distances[empty_index] <= Probe_Length);
+        ++empty_index;
+      }
+
+      has_room = has_room && (empty_index < Number_Of_Slots);
+
+      ETL_ASSERT_OR_RETURN_VALUE(has_room, ETL_ERROR(unordered_flat_map_probe_limit), Number_Of_Slots);
+
+      // Shift the elements along by one.
+      while (empty_index != index)
+      {
+        move_slot(empty_index, empty_index - 1U);
+        p_distances[empty_index] = uint8_t(p_distances[empty_index - 1U] + 1U);
+        --empty_index;
+      }
+
+      p_distances[index] = Empty;
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Marks a slot, into which an element with the home bucket 'home' has
+    /// been constructed, as occupied.
+    //*********************************************************************
+    void occupy_at(size_t home, size_t index)
+    {
+      p_distances[index] = uint8_t(index - home + 1U);
+      ++element_count;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+
+    //*********************************************************************
+    /// Erases the element at 'index', shifting the following elements in the
+    /// same run back by one.
+    //*********************************************************************
+    void erase_at(size_t index)
+    {
+      slot(index).~value_type();
+      --element_count;
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      size_t next = index + 1U;
+
+      // Shift back the elements that are not in their home bucket.
+      while ((next < Number_Of_Slots) && (p_distances[next] > 1U))
+      {
+        move_slot(index, next);
+        p_distances[index] = uint8_t(p_distances[next] - 1U);
+
+        index = next;
+        ++next;
+      }
+
+      p_distances[index] = Empty;
+    }
+
+    // Disable copy construction.
+    iunordered_flat_map(const iunordered_flat_map&);
+
+    slot_t*  p_slots;       ///< The storage for the elements.
+    uint8_t* p_distances;   ///< The distance of each element from its home bucket + 1, or Empty.
+    size_t   element_count; ///< The number of elements.
+
+    const size_t Max_Size;        ///< The maximum number of elements.
+    const size_t Bucket_Count;    ///< The number of home buckets.
+    const size_t Probe_Length;    ///< The furthest that an element may be from its home bucket.
+    const size_t Number_Of_Slots; ///< Bucket_Count + Probe_Length.
+    const size_t Hash_Shift;      ///< The shift that reduces the mixed hash to a bucket index.
+
+    hasher    key_hash_function;  ///< The function that creates the hashes.
+    key_equal key_equal_function; ///< The function that compares the keys for equality.
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNORDERED_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~iunordered_flat_map() {}
+#else
+
+  protected:
+
+    ~iunordered_flat_map() {}
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator==(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs, const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typedef typename etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>::const_iterator itr_t;
+
+    for (itr_t l_itr = lhs.begin(); l_itr != lhs.end(); ++l_itr)
+    {
+      itr_t r_itr = rhs.find(l_itr->first);
+
+      if ((r_itr == rhs.end()) || !(r_itr->second == l_itr->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first unordered_flat_map.
+  ///\param rhs Reference to the second unordered_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator!=(const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& lhs, const etl::iunordered_flat_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated unordered_flat_map implementation that uses a fixed size
+  /// buffer.
+  /// The number of buckets is the power of two that keeps the load factor
+  /// below 0.8 when full.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_map : public etl::iunordered_flat_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef iunordered_flat_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE     = MAX_SIZE_;
+    static ETL_CONSTANT size_t BUCKET_COUNT = etl::power_of_2_round_up<MAX_SIZE_ + (MAX_SIZE_ / 4U) + 1U>::value;
+    static ETL_CONSTANT size_t PROBE_LENGTH =
+      (BUCKET_COUNT < size_t(ETL_UNORDERED_FLAT_MAP_MAX_PROBE_LENGTH)) ? BUCKET_COUNT : size_t(ETL_UNORDERED_FLAT_MAP_MAX_PROBE_LENGTH);
+
+    ETL_STATIC_ASSERT(ETL_UNORDERED_FLAT_MAP_MAX_PROBE_LENGTH <= 128, "The probe length must be no more than 128");
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unordered_flat_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, distances, MAX_SIZE_, BUCKET_COUNT, PROBE_LENGTH, Hash_Shift, hash, equal)
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_map(const unordered_flat_map& other)
+      : base(slots, distances, MAX_SIZE_, BUCKET_COUNT, PROBE_LENGTH, Hash_Shift, other.hash_function(), other.key_eq())
+    {
+      base::initialise();
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_flat_map(unordered_flat_map&& other)
+      : base(slots, distances, MAX_SIZE_, BUCKET_COUNT, PROBE_LENGTH, Hash_Shift, other.hash_function(), other.key_eq())
+    {
+      base::initialise();
+
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, distances, MAX_SIZE_, BUCKET_COUNT, PROBE_LENGTH, Hash_Shift, hash, equal)
+    {
+      base::initialise();
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_flat_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, distances, MAX_SIZE_, BUCKET_COUNT, PROBE_LENGTH, Hash_Shift, hash, equal)
+    {
+      base::initialise();
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator=(const unordered_flat_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_map& operator=(unordered_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    static ETL_CONSTANT size_t Hash_Shift = etl::integral_limits<size_t>::bits - etl::log2<BUCKET_COUNT>::value;
+
+    /// The storage for the elements.
+    typename base::slot_t slots[BUCKET_COUNT + PROBE_LENGTH];
+
+    /// The distance of each element from its home bucket.
+    uint8_t distances[BUCKET_COUNT + PROBE_LENGTH];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::BUCKET_COUNT;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::PROBE_LENGTH;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::Hash_Shift;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  unordered_flat_map(TPairs...) -> unordered_flat_map<typename etl::nth_type_t<0, TPairs...>::first_type, typename etl::nth_type_t<0, TPairs...>::second_type,
+                                                      sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... TPairs>
+  constexpr auto make_unordered_flat_map(TPairs&&... pairs) -> etl::unordered_flat_map<TKey, T, sizeof...(TPairs), THash, TKeyEqual>
+  {
+    return {etl::forward<TPairs>(pairs)...};
+  }
+#endif
+} // namespace etl
+
+#endif
@@ -0,0 +1,394 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+#include "platform.h"
+#include "error_handler.h"
+#include "ihash.h"
+#include "iterator.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_64BIT_TYPES
+
+///\defgroup wyhash wyhash 64 bit hash calculation
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+  #if defined(__SIZEOF_INT128__) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG))
+    __extension__ typedef unsigned __int128 uint128_t;
+  #endif
+
+    static ETL_CONSTANT uint64_t Secret0 = 0xA0761D6478BD642FULL;
+    static ETL_CONSTANT uint64_t Secret1 = 0xE7037ED1A0B428DBULL;
+    static ETL_CONSTANT uint64_t Secret2 = 0x8EBC6AF09C88C6E3ULL;
+    static ETL_CONSTANT uint64_t Secret3 = 0x589965CC75374CC3ULL;
+
+    //*************************************************************************
+    /// Multiplies a by b, giving the low half in a and the high half in b.
+    //*************************************************************************
+    inline void multiply(uint64_t& a, uint64_t& b)
+    {
+  #if defined(__SIZEOF_INT128__) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG))
+      const uint128_t r = static_cast<uint128_t>(a) * b;
+
+      a = static_cast<uint64_t>(r);
+      b = static_cast<uint64_t>(r >> 64U);
+  #else
+      const uint64_t ha = a >> 32U;
+      const uint64_t hb = b >> 32U;
+      const uint64_t la = static_cast<uint32_t>(a);
+      const uint64_t lb = static_cast<uint32_t>(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+
+      const uint64_t t  = rl + (rm0 << 32U);
+      uint64_t       c  = (t < rl) ? 1U : 0U;
+      const uint64_t lo = t + (rm1 << 32U);
+      c += (lo < t) ? 1U : 0U;
+
+      a = lo;
+      b = rh + (rm0 >> 32U) + (rm1 >> 32U) + c;
+  #endif
+    }
+
+    //*************************************************************************
+    /// Multiplies a by b and folds the 128 bit result.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      multiply(a, b);
+
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    /// Reads 8 little endian bytes.
+    /// Compilers reduce this to a single load on little endian targets.
+    //*************************************************************************
+    inline uint64_t read8(const uint8_t* p)
+    {
+      return  static_cast<uint64_t>(p[0])         | (static_cast<uint64_t>(p[1]) << 8U)
+           | (static_cast<uint64_t>(p[2]) << 16U) | (static_cast<uint64_t>(p[3]) << 24U)
+           | (static_cast<uint64_t>(p[4]) << 32U) | (static_cast<uint64_t>(p[5]) << 40U)
+           | (static_cast<uint64_t>(p[6]) << 48U) | (static_cast<uint64_t>(p[7]) << 56U);
+    }
+
+    //*************************************************************************
+    /// Reads 4 little endian bytes.
+    //*************************************************************************
+    inline uint64_t read4(const uint8_t* p)
+    {
+      return  static_cast<uint64_t>(p[0])         | (static_cast<uint64_t>(p[1]) << 8U)
+           | (static_cast<uint64_t>(p[2]) << 16U) | (static_cast<uint64_t>(p[3]) << 24U);
+    }
+
+    //*************************************************************************
+    /// Reads 1 to 3 bytes.
+    //*************************************************************************
+    inline uint64_t read3(const uint8_t* p, size_t k)
+    {
+      return (static_cast<uint64_t>(p[0]) << 16U) | (static_cast<uint64_t>(p[k >> 1U]) << 8U) | p[k - 1U];
+    }
+  } // namespace private_wyhash
+
+  //***************************************************************************
+  /// Calculates the 64 bit wyhash (final version 3), by Wang Yi.
+  /// See https://github.com/wangyi-fudan/wyhash for more details.
+  /// Input is consumed eight bytes per multiply, in 48 byte stripes of three
+  /// independent lanes, so it is much faster than FNV-1a for keys longer than
+  /// a few bytes, and every bit of the input affects every bit of the result.
+  /// It is not a cryptographic hash.
+  ///\ingroup wyhash
+  //***************************************************************************
+  class wyhash
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    wyhash(value_type seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template <typename TIterator>
+    wyhash(TIterator begin, const TIterator end, value_type seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      hash          = seed ^ private_wyhash::Secret0;
+      lane1         = hash;
+      lane2         = hash;
+      char_count    = 0U;
+      pending_count = 0U;
+      is_finalised  = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// Contiguous ranges of bytes are hashed in place, other ranges a byte at a
+    /// time.
+    /// If the hash has already been finalised then a 'hash_finalised' error
+    /// will be emitted.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template <typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error
+    /// will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      add_bytes(&value_, 1U);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a range of bytes in contiguous memory.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      add_bytes(reinterpret_cast<const uint8_t*>(begin), static_cast<size_t>(end - begin));
+    }
+
+    //*************************************************************************
+    /// Adds a range of bytes that may not be in contiguous memory.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        const uint8_t value_ = static_cast<uint8_t>(*begin);
+        add_bytes(&value_, 1U);
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds bytes to the hash.
+    /// A stripe is only hashed once it is known that more data follows it, as
+    /// the last 1 to 48 bytes are hashed differently by finalise().
+    //*************************************************************************
+    void add_bytes(const uint8_t* p, size_t length)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT_OR_RETURN(!is_finalised, ETL_ERROR(hash_finalised));
+
+      char_count += length;
+
+      while (length != 0U)
+      {
+        if (pending_count == Stripe_Size)
+        {
+          add_stripe(buffer + History_Size);
+          copy(buffer, buffer + Stripe_Size, History_Size);
+          pending_count = 0U;
+        }
+
+        if ((pending_count == 0U) && (length > Stripe_Size))
+        {
+          // Hash whole stripes in place.
+          do
+          {
+            add_stripe(p);
+            p      += Stripe_Size;
+            length -= Stripe_Size;
+          } while (length > Stripe_Size);
+
+          copy(buffer, p - History_Size, History_Size);
+        }
+
+        const size_t free_count = Stripe_Size - pending_count;
+        const size_t n          = (length < free_count) ? length : free_count;
+
+        copy(buffer + History_Size + pending_count, p, n);
+        pending_count += n;
+        p             += n;
+        length        -= n;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a 48 byte stripe.
+    //*************************************************************************
+    void add_stripe(const uint8_t* p)
+    {
+      hash  = private_wyhash::mix(private_wyhash::read8(p) ^ private_wyhash::Secret1, private_wyhash::read8(p + 8U) ^ hash);
+      lane1 = private_wyhash::mix(private_wyhash::read8(p + 16U) ^ private_wyhash::Secret2, private_wyhash::read8(p + 24U) ^ lane1);
+      lane2 = private_wyhash::mix(private_wyhash::read8(p + 32U) ^ private_wyhash::Secret3, private_wyhash::read8(p + 40U) ^ lane2);
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        // The unhashed bytes, preceded by at least 16 bytes of history when
+        // more than 16 bytes have been added.
+        const uint8_t* p = buffer + History_Size;
+        size_t         i = pending_count;
+        uint64_t       a;
+        uint64_t       b;
+
+        if (char_count <= 16U)
+        {
+          if (i >= 4U)
+          {
+            const size_t offset = (i >> 3U) << 2U;
+
+            a = (private_wyhash::read4(p) << 32U) | private_wyhash::read4(p + offset);
+            b = (private_wyhash::read4(p + i - 4U) << 32U) | private_wyhash::read4(p + i - 4U - offset);
+          }
+          else if (i > 0U)
+          {
+            a = private_wyhash::read3(p, i);
+            b = 0U;
+          }
+          else
+          {
+            a = 0U;
+            b = 0U;
+          }
+        }
+        else
+        {
+          if (char_count > Stripe_Size)
+          {
+            hash ^= lane1 ^ lane2;
+          }
+
+          while (i > 16U)
+          {
+            hash = private_wyhash::mix(private_wyhash::read8(p) ^ private_wyhash::Secret1, private_wyhash::read8(p + 8U) ^ hash);
+            p += 16U;
+            i -= 16U;
+          }
+
+          a = private_wyhash::read8(p + i - 16U);
+          b = private_wyhash::read8(p + i - 8U);
+        }
+
+        hash = private_wyhash::mix(private_wyhash::Secret1 ^ static_cast<uint64_t>(char_count),
+                                   private_wyhash::mix(a ^ private_wyhash::Secret1, b ^ hash));
+
+        is_finalised = true;
+      }
+    }
+
+    //*************************************************************************
+    /// Copies bytes.
+    //*************************************************************************
+    static void copy(uint8_t* destination, const uint8_t* source, size_t length)
+    {
+      while (length-- != 0U)
+      {
+        *destination++ = *source++;
+      }
+    }
+
+    static ETL_CONSTANT size_t Stripe_Size  = 48U;
+    static ETL_CONSTANT size_t History_Size = 16U;
+
+    value_type seed;
+    value_type hash;
+    value_type lane1;
+    value_type lane2;
+    size_t     char_count;
+    size_t     pending_count;
+    bool       is_finalised;
+    uint8_t    buffer[History_Size + Stripe_Size]; ///< The last 16 hashed bytes, then the unhashed bytes.
+  };
+} // namespace etl
+
+#endif
+
+#endif
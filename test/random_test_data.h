@@ -0,0 +1,55 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TEST_RANDOM_TEST_DATA_INCLUDED
+#define ETL_TEST_RANDOM_TEST_DATA_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+//*****************************************************************************
+/// Returns 'length' bytes of pseudo random test data.
+/// The same seed always gives the same data.
+//*****************************************************************************
+inline std::vector<uint8_t> make_random_data(size_t length, uint32_t seed = 12345U)
+{
+  std::vector<uint8_t> data(length);
+
+  for (size_t i = 0UL; i < length; ++i)
+  {
+    seed    = (seed * 1664525UL) + 1013904223UL;
+    data[i] = uint8_t(seed >> 24U);
+  }
+
+  return data;
+}
+
+#endif
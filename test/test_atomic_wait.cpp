@@ -0,0 +1,160 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <chrono>
+#include <thread>
+
+#include "etl/atomic.h"
+#include "etl/chrono.h"
+#include "etl/private/atomic_wait.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  //***************************************************************************
+  // A clock that counts the number of times that it is read.
+  //***************************************************************************
+  struct CountingClock
+  {
+    using duration   = etl::chrono::microseconds;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = etl::chrono::time_point<CountingClock, duration>;
+
+    static time_point now()
+    {
+      ++reads;
+
+      const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch());
+
+      return time_point(duration(static_cast<rep>(elapsed.count())));
+    }
+
+    static int reads;
+  };
+
+  int CountingClock::reads = 0;
+
+  SUITE(test_atomic_wait)
+  {
+  #if ETL_HAS_ATOMIC_WAIT
+    //*************************************************************************
+    TEST(test_wait_parks_until_notified)
+    {
+      etl::atomic<int>  value(0);
+      etl::atomic<bool> waiting(false);
+      etl::atomic<bool> returned(false);
+
+      std::thread waiter([&]()
+                         {
+                           etl::private_atomic_wait::wait_while_equal(value, 0, waiting);
+                           returned.store(true);
+                         });
+
+      // The flag is only set once the waiter has stopped spinning and is about to block.
+      while (!waiting.load())
+      {
+        std::this_thread::yield();
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      CHECK_FALSE(returned.load());
+
+      value.store(1);
+      etl::private_atomic_wait::notify(value, waiting);
+
+      waiter.join();
+
+      CHECK_TRUE(returned.load());
+      CHECK_FALSE(waiting.load());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_does_not_park_if_the_value_has_changed)
+    {
+      etl::atomic<int>  value(1);
+      etl::atomic<bool> waiting(false);
+
+      etl::private_atomic_wait::wait_while_equal(value, 0, waiting);
+
+      CHECK_FALSE(waiting.load());
+    }
+  #endif
+
+    //*************************************************************************
+    TEST(test_wait_until_times_out)
+    {
+      etl::atomic<int> value(0);
+
+      CountingClock::reads = 0;
+
+      const auto start  = std::chrono::steady_clock::now();
+      const bool result = etl::private_atomic_wait::wait_while_equal_until(value, 0, CountingClock::now() + etl::chrono::milliseconds(50));
+      const auto end    = std::chrono::steady_clock::now();
+
+      CHECK_FALSE(result);
+      CHECK_TRUE((end - start) >= std::chrono::milliseconds(50));
+
+      // Sleeping between checks reads the clock about once per millisecond, where
+      // yielding would read it many thousands of times.
+      CHECK_TRUE(CountingClock::reads < 200);
+    }
+
+    //*************************************************************************
+    TEST(test_wait_until_returns_when_the_value_changes)
+    {
+      etl::atomic<int> value(0);
+
+      std::thread writer([&]()
+                         {
+                           std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                           value.store(1);
+                         });
+
+      const bool result = etl::private_atomic_wait::wait_while_equal_until(value, 0, CountingClock::now() + etl::chrono::seconds(10));
+
+      writer.join();
+
+      CHECK_TRUE(result);
+      CHECK_EQUAL(1, value.load());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_until_deadline_passed)
+    {
+      etl::atomic<int> value(0);
+
+      CHECK_FALSE(etl::private_atomic_wait::wait_while_equal_until(value, 0, CountingClock::now()));
+      CHECK_TRUE(etl::private_atomic_wait::wait_while_equal_until(value, 1, CountingClock::now()));
+    }
+  }
+} // namespace
+
+#endif
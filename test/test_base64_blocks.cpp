@@ -0,0 +1,155 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+#include "random_test_data.h"
+
+#include "etl/base64_decoder.h"
+#include "etl/base64_encoder.h"
+
+#include <list>
+#include <string>
+#include <vector>
+
+//*****************************************************************************
+// Checks that ranges of pointers, which are encoded and decoded in blocks,
+// give the same results as other iterators, which are processed one
+// character at a time.
+//*****************************************************************************
+
+namespace
+{
+  //***************************************************************************
+  template <typename TEncoder, typename TDecoder>
+  void check_round_trip()
+  {
+    for (size_t length = 0UL; length < 200UL; ++length)
+    {
+      std::vector<uint8_t> data = make_random_data(length);
+      std::list<unsigned char>   data_list(data.begin(), data.end());
+
+      TEncoder encoder_blocks;
+      TEncoder encoder_octets;
+
+      CHECK_TRUE(encoder_blocks.encode_final(data.data(), data.size()));
+      CHECK_TRUE(encoder_octets.encode_final(data_list.begin(), data_list.end()));
+
+      std::string encoded(encoder_blocks.begin(), encoder_blocks.end());
+      std::string expected(encoder_octets.begin(), encoder_octets.end());
+
+      CHECK_EQUAL(expected, encoded);
+
+      TDecoder decoder;
+
+      CHECK_TRUE(decoder.decode_final(encoded.data(), encoded.data() + encoded.size()));
+
+      std::vector<unsigned char> decoded(decoder.begin(), decoder.end());
+
+      CHECK_TRUE(data == decoded);
+    }
+  }
+
+  //***************************************************************************
+  template <typename TEncoder, typename TDecoder>
+  void check_chunked_with_callback()
+  {
+    std::vector<uint8_t> data = make_random_data(1000UL);
+
+    std::string                encoded;
+    std::vector<unsigned char> decoded;
+
+    auto encoder_callback = [&encoded](const typename TEncoder::span_type& span) { encoded.append(span.begin(), span.end()); };
+    auto decoder_callback = [&decoded](const typename TDecoder::span_type& span) { decoded.insert(decoded.end(), span.begin(), span.end()); };
+
+    TEncoder encoder(encoder_callback);
+    TDecoder decoder(decoder_callback);
+
+    // Chunks that do not align with the groups.
+    for (size_t i = 0UL; i < data.size(); i += 37UL)
+    {
+      CHECK_TRUE(encoder.encode(data.data() + i, std::min(size_t(37UL), data.size() - i)));
+    }
+
+    CHECK_TRUE(encoder.flush());
+
+    for (size_t i = 0UL; i < encoded.size(); i += 29UL)
+    {
+      CHECK_TRUE(decoder.decode(encoded.data() + i, std::min(size_t(29UL), encoded.size() - i)));
+    }
+
+    CHECK_TRUE(decoder.flush());
+
+    CHECK_TRUE(data == decoded);
+  }
+
+  SUITE(test_base64_blocks)
+  {
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      check_round_trip<etl::base64_rfc2152_encoder<400>, etl::base64_rfc2152_decoder<300>>();
+      check_round_trip<etl::base64_rfc3501_encoder<400>, etl::base64_rfc3501_decoder<300>>();
+      check_round_trip<etl::base64_rfc4648_encoder<400>, etl::base64_rfc4648_decoder<300>>();
+      check_round_trip<etl::base64_rfc4648_padding_encoder<400>, etl::base64_rfc4648_padding_decoder<300>>();
+      check_round_trip<etl::base64_rfc4648_url_encoder<400>, etl::base64_rfc4648_url_decoder<300>>();
+      check_round_trip<etl::base64_rfc4648_url_padding_encoder<400>, etl::base64_rfc4648_url_padding_decoder<300>>();
+    }
+
+    //*************************************************************************
+    TEST(test_chunked_with_callback)
+    {
+      check_chunked_with_callback<etl::base64_rfc4648_padding_encoder<48>, etl::base64_rfc4648_padding_decoder<33>>();
+      check_chunked_with_callback<etl::base64_rfc4648_url_encoder<4>, etl::base64_rfc4648_url_decoder<3>>();
+      check_chunked_with_callback<etl::base64_rfc3501_encoder<64>, etl::base64_rfc3501_decoder<63>>();
+    }
+
+    //*************************************************************************
+    TEST(test_decode_invalid_character_in_block)
+    {
+      const std::string valid = "QUJDREVGR0hJSktMTU5PUFFSU1RVVldYWVowMTIzNDU2Nzg5";
+
+      etl::base64_rfc4648_decoder<60> valid_decoder;
+      CHECK_TRUE(valid_decoder.decode_final(valid.data(), valid.size()));
+      CHECK_EQUAL(std::string("ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"), std::string(valid_decoder.begin(), valid_decoder.end()));
+
+      // A space, a character from another alphabet and a character above 0x7F.
+      const char invalid[] = {' ', '_', '\xC3'};
+
+      for (size_t i = 0UL; i < sizeof(invalid); ++i)
+      {
+        std::string encoded = valid;
+        encoded[35]         = invalid[i];
+
+        etl::base64_rfc4648_decoder<60> decoder;
+
+        CHECK_THROW(decoder.decode(encoded.data(), encoded.size()), etl::base64_invalid_data);
+        CHECK_TRUE(decoder.error());
+      }
+    }
+  }
+} // namespace
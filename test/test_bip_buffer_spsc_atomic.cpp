@@ -48,6 +48,26 @@ SOFTWARE.
 
 namespace
 {
+  //***************************************************************************
+  // A clock that advances by one tick each time it is read.
+  //***************************************************************************
+  struct ManualClock
+  {
+    using duration   = etl::chrono::milliseconds;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = etl::chrono::time_point<ManualClock, duration>;
+
+    static time_point now()
+    {
+      return time_point(duration(++ticks));
+    }
+
+    static rep ticks;
+  };
+
+  ManualClock::rep ManualClock::ticks = 0;
+
   SUITE(test_bip_buffer_spsc_atomic)
   {
     //*************************************************************************
@@ -461,6 +481,86 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_reserve_wait_ready)
+    {
+      etl::bip_buffer_spsc_atomic<int, 8> stream;
+
+      etl::span<int> writer = stream.write_reserve_wait(5U);
+      CHECK_EQUAL(5U, writer.size());
+      std::fill_n(writer.begin(), writer.size(), 1);
+      stream.write_commit(writer);
+
+      etl::span<int> reader = stream.read_reserve_wait();
+      CHECK_EQUAL(5U, reader.size());
+      stream.read_commit(reader);
+
+      CHECK(stream.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_wait_until_timeout)
+    {
+      etl::bip_buffer_spsc_atomic<int, 4> stream;
+
+      CHECK(stream.read_reserve_wait_until(4U, ManualClock::now() + etl::chrono::milliseconds(10)).empty());
+
+      etl::span<int> writer = stream.write_reserve_wait_until(4U, ManualClock::now() + etl::chrono::milliseconds(10));
+      CHECK_EQUAL(4U, writer.size());
+      stream.write_commit(writer);
+
+      CHECK(stream.write_reserve_wait_until(1U, ManualClock::now() + etl::chrono::milliseconds(10)).empty());
+
+      etl::span<int> reader = stream.read_reserve_wait_until(4U, ManualClock::now() + etl::chrono::milliseconds(10));
+      CHECK_EQUAL(4U, reader.size());
+    }
+
+    //*************************************************************************
+  #if REALTIME_TEST
+    TEST(test_reserve_wait_threads)
+    {
+      static const int Length = 10000;
+
+      etl::bip_buffer_spsc_atomic<int, 16> stream;
+
+      std::thread writer_thread([&stream]()
+                                {
+                                  int value = 0;
+
+                                  while (value < Length)
+                                  {
+                                    etl::span<int> writer = stream.write_reserve_wait(3U);
+
+                                    for (size_t i = 0U; i < writer.size(); ++i)
+                                    {
+                                      writer[i] = value++;
+                                    }
+
+                                    stream.write_commit(writer);
+                                  }
+                                });
+
+      bool in_order = true;
+      int  expected = 0;
+
+      while (expected < Length)
+      {
+        etl::span<int> reader = stream.read_reserve_wait();
+
+        for (size_t i = 0U; i < reader.size(); ++i)
+        {
+          in_order = in_order && (reader[i] == expected++);
+        }
+
+        stream.read_commit(reader);
+      }
+
+      writer_thread.join();
+
+      CHECK(in_order);
+    }
+  #endif
+
     //*************************************************************************
   #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently
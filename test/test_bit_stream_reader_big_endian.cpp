@@ -1488,6 +1488,49 @@ namespace
       CHECK_EQUAL(object2.i, result2.i);
       CHECK_EQUAL(object2.c, result2.c);
     }
+
+    //*************************************************************************
+    TEST(test_read_odd_widths_written_by_writer)
+    {
+      // Every width from 1 to 64, at every bit offset, up to the last bit of the stream.
+      std::array<char, 2080 / CHAR_BIT> storage;
+
+      for (int order = 0; order < 2; ++order)
+      {
+        const etl::bit_order bit_order = (order == 0) ? etl::bit_order::msb_first : etl::bit_order::lsb_first;
+
+        storage.fill(0);
+
+        etl::bit_stream_writer writer(storage.data(), storage.size(), bit_order);
+
+        uint64_t value = 0x0123456789ABCDEFULL;
+
+        for (uint_least8_t nbits = 1U; nbits <= 64U; ++nbits)
+        {
+          value = (value * 6364136223846793005ULL) + 1442695040888963407ULL;
+          CHECK_TRUE(writer.write(value, nbits));
+        }
+
+        CHECK_TRUE(writer.full());
+
+        etl::bit_stream_reader reader(storage.data(), storage.size(), bit_order);
+
+        value = 0x0123456789ABCDEFULL;
+
+        for (uint_least8_t nbits = 1U; nbits <= 64U; ++nbits)
+        {
+          value = (value * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+          const uint64_t expected = (nbits == 64U) ? value : (value & ((uint64_t(1U) << nbits) - 1U));
+
+          etl::optional<uint64_t> result = reader.read<uint64_t>(nbits);
+          CHECK_TRUE(result.has_value());
+          CHECK_EQUAL(expected, result.value());
+        }
+
+        CHECK_FALSE(reader.read<uint8_t>(1U).has_value());
+      }
+    }
   }
 } // namespace
 
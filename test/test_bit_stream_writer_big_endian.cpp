@@ -971,6 +971,39 @@ namespace
       CHECK(result.has_value());
       CHECK_EQUAL(uint16_t(0x0ABC), result.value());
     }
+
+    //*************************************************************************
+    TEST(test_write_leaves_following_data_unchanged)
+    {
+      std::array<char, 16> storage;
+      storage.fill(char(0x5A));
+
+      etl::bit_stream_writer writer(storage.data(), storage.size(), etl::bit_order::msb_first);
+
+      // A new char is cleared before it is written.
+      CHECK(writer.write(uint8_t(0x05), 3));
+      CHECK_EQUAL(int(char(0xA0)), int(storage[0]));
+
+      CHECK(writer.write(uint32_t(0x1FFFFFFFUL), 29));
+      CHECK_EQUAL(int(char(0xBF)), int(storage[0]));
+      CHECK_EQUAL(int(char(0xFF)), int(storage[1]));
+      CHECK_EQUAL(int(char(0xFF)), int(storage[2]));
+      CHECK_EQUAL(int(char(0xFF)), int(storage[3]));
+
+      // The skipped chars, and those after the written bits, are unchanged.
+      CHECK(writer.skip(16U));
+      CHECK(writer.write(uint16_t(0x0001), 12));
+
+      CHECK_EQUAL(int(char(0x5A)), int(storage[4]));
+      CHECK_EQUAL(int(char(0x5A)), int(storage[5]));
+      CHECK_EQUAL(int(char(0x00)), int(storage[6]));
+      CHECK_EQUAL(int(char(0x10)), int(storage[7]));
+
+      for (size_t i = 8UL; i < storage.size(); ++i)
+      {
+        CHECK_EQUAL(int(char(0x5A)), int(storage[i]));
+      }
+    }
   }
 } // namespace
 
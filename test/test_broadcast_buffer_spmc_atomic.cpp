@@ -0,0 +1,409 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/broadcast_buffer_spmc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+  #define REALTIME_TEST 0
+
+namespace
+{
+  using ItemNDC = TestDataNDC<std::string>;
+
+  SUITE(test_broadcast_buffer_spmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 4, 3> buffer;
+
+      CHECK_EQUAL(4U, buffer.max_size());
+      CHECK_EQUAL(4U, buffer.capacity());
+      CHECK_EQUAL(4U, buffer.available());
+      CHECK_EQUAL(3U, buffer.number_of_consumers());
+      CHECK(!buffer.full());
+
+      for (size_t c = 0; c < buffer.number_of_consumers(); ++c)
+      {
+        CHECK(buffer.empty(c));
+        CHECK_EQUAL(0U, buffer.size(c));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_every_consumer_reads_every_item)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 4, 3> buffer;
+      etl::ibroadcast_buffer_spmc_atomic<int>&      ibuffer = buffer;
+
+      CHECK(ibuffer.push(1));
+      CHECK(ibuffer.push(2));
+      CHECK(ibuffer.push(3));
+
+      for (size_t c = 0; c < ibuffer.number_of_consumers(); ++c)
+      {
+        CHECK_EQUAL(3U, ibuffer.size(c));
+      }
+
+      int value = 0;
+
+      for (size_t c = 0; c < ibuffer.number_of_consumers(); ++c)
+      {
+        CHECK(ibuffer.pop(c, value));
+        CHECK_EQUAL(1, value);
+        CHECK(ibuffer.pop(c, value));
+        CHECK_EQUAL(2, value);
+        CHECK(ibuffer.pop(c, value));
+        CHECK_EQUAL(3, value);
+        CHECK(!ibuffer.pop(c, value));
+        CHECK(ibuffer.empty(c));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_producer_blocks_on_slowest_consumer)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 4, 2> buffer;
+
+      int value = 0;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(buffer.push(i));
+      }
+
+      CHECK(buffer.full());
+      CHECK(!buffer.push(4));
+
+      // The fast consumer reads everything, but the slow consumer still blocks the producer.
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(buffer.pop(0, value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(buffer.full());
+      CHECK_EQUAL(0U, buffer.available());
+      CHECK(!buffer.push(4));
+
+      CHECK(buffer.pop(1, value));
+      CHECK_EQUAL(0, value);
+
+      CHECK(!buffer.full());
+      CHECK_EQUAL(1U, buffer.available());
+      CHECK(buffer.push(4));
+      CHECK(!buffer.push(5));
+
+      CHECK_EQUAL(1U, buffer.size(0));
+      CHECK_EQUAL(4U, buffer.size(1));
+
+      for (int i = 1; i < 5; ++i)
+      {
+        CHECK(buffer.pop(1, value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(buffer.pop(0, value));
+      CHECK_EQUAL(4, value);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_wrap_around)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 3, 2> buffer;
+
+      int value = 0;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK(buffer.push(i));
+        CHECK(buffer.push(i + 100));
+
+        for (size_t c = 0; c < 2; ++c)
+        {
+          CHECK(buffer.pop(c, value));
+          CHECK_EQUAL(i, value);
+          CHECK(buffer.pop(c, value));
+          CHECK_EQUAL(i + 100, value);
+          CHECK(buffer.empty(c));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_span)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 5, 2> buffer;
+
+      const int input[] = { 0, 1, 2, 3, 4, 5, 6 };
+      int       output0[7];
+      int       output1[7];
+
+      // Move the indexes so that the data wraps around the end of the buffer.
+      buffer.push(input[0]);
+      buffer.push(input[0]);
+      buffer.pop(0, output0[0]);
+      buffer.pop(0, output0[0]);
+      buffer.pop(1, output1[0]);
+      buffer.pop(1, output1[0]);
+
+      CHECK_EQUAL(5U, buffer.push(etl::span<const int>(input)));
+
+      CHECK_EQUAL(2U, buffer.pop(0, etl::span<int>(output0, 2)));
+      CHECK_EQUAL(3U, buffer.pop(0, etl::span<int>(output0 + 2, 5)));
+      CHECK_EQUAL(5U, buffer.pop(1, etl::span<int>(output1)));
+
+      CHECK_ARRAY_EQUAL(input, output0, 5);
+      CHECK_ARRAY_EQUAL(input, output1, 5);
+      CHECK(buffer.empty(0));
+      CHECK(buffer.empty(1));
+    }
+
+    //*************************************************************************
+    TEST(test_read_acquire_release)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 5, 2> buffer;
+
+      int value;
+
+      // Move the indexes so that the data wraps around the end of the buffer.
+      for (int i = 0; i < 4; ++i)
+      {
+        buffer.push(i);
+        buffer.pop(0, value);
+        buffer.pop(1, value);
+      }
+
+      for (int i = 0; i < 5; ++i)
+      {
+        buffer.push(i);
+      }
+
+      etl::broadcast_buffer_spmc_atomic<int, 5, 2>::region_type region = buffer.read_acquire(0);
+
+      CHECK_EQUAL(5U, region.size());
+      CHECK_EQUAL(2U, region.first.size());
+      CHECK_EQUAL(3U, region.second.size());
+      CHECK_EQUAL(0, region.first[0]);
+      CHECK_EQUAL(1, region.first[1]);
+      CHECK_EQUAL(2, region.second[0]);
+      CHECK_EQUAL(3, region.second[1]);
+      CHECK_EQUAL(4, region.second[2]);
+
+      CHECK(buffer.read_release(0, 3U));
+      CHECK_EQUAL(2U, buffer.size(0));
+      CHECK_EQUAL(5U, buffer.size(1));
+
+      region = buffer.read_acquire(1, 2U);
+      CHECK_EQUAL(2U, region.size());
+      CHECK(region.second.empty());
+      CHECK(buffer.read_release(1, 2U));
+
+      CHECK_EQUAL(2U, buffer.available());
+
+      buffer.clear(0);
+      buffer.clear(1);
+      CHECK(buffer.empty(0));
+      CHECK(buffer.empty(1));
+      CHECK(buffer.read_acquire(0).empty());
+      CHECK_EQUAL(5U, buffer.available());
+    }
+
+    //*************************************************************************
+    TEST(test_release_too_many)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 4, 2> buffer;
+
+      buffer.push(1);
+
+      CHECK_THROW(buffer.read_release(0, 2U), etl::broadcast_buffer_spmc_atomic_release_invalid);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_consumer)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 4, 2> buffer;
+
+      int value;
+
+      CHECK_THROW(buffer.pop(2, value), etl::broadcast_buffer_spmc_atomic_invalid_consumer);
+    }
+
+    //*************************************************************************
+    TEST(test_overwrite)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 4, 2, true> buffer;
+
+      int value = 0;
+
+      // Consumer 0 keeps up.
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK(buffer.push(i));
+        CHECK(buffer.pop(0, value));
+        CHECK_EQUAL(i, value);
+      }
+
+      // Consumer 1 has lost all but the last 4.
+      CHECK_EQUAL(4U, buffer.size(1));
+
+      for (int i = 6; i < 10; ++i)
+      {
+        CHECK(buffer.pop(1, value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(!buffer.pop(1, value));
+    }
+
+    //*************************************************************************
+    TEST(test_overwrite_during_read)
+    {
+      etl::broadcast_buffer_spmc_atomic<int, 4, 1, true> buffer;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        buffer.push(i);
+      }
+
+      etl::broadcast_buffer_spmc_atomic<int, 4, 1, true>::region_type region = buffer.read_acquire(0);
+      CHECK_EQUAL(4U, region.size());
+
+      // The producer overwrites the oldest item while the region is being read.
+      buffer.push(4);
+
+      CHECK(!buffer.read_release(0, 4U));
+
+      int output[4];
+      CHECK_EQUAL(4U, buffer.pop(0, etl::span<int>(output)));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(4, output[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_non_default_constructible)
+    {
+      int current_count = ItemNDC::get_instance_count();
+
+      {
+        etl::broadcast_buffer_spmc_atomic<ItemNDC, 2, 2> buffer;
+
+        ItemNDC value("z");
+
+        for (int i = 0; i < 3; ++i)
+        {
+          CHECK(buffer.push(ItemNDC("a")));
+          CHECK(buffer.push(ItemNDC("b")));
+
+          for (size_t c = 0; c < 2; ++c)
+          {
+            CHECK(buffer.pop(c, value));
+            CHECK_EQUAL(ItemNDC("a"), value);
+            CHECK(buffer.pop(c, value));
+            CHECK_EQUAL(ItemNDC("b"), value);
+          }
+        }
+      }
+
+      CHECK_EQUAL(current_count, ItemNDC::get_instance_count());
+    }
+
+  #if REALTIME_TEST
+    //*************************************************************************
+    TEST(broadcast_threads)
+    {
+      static const size_t N_Consumers = 3;
+      static const int    Length      = 100000;
+
+      etl::broadcast_buffer_spmc_atomic<int, 64, N_Consumers> buffer;
+
+      std::vector<std::vector<int>> popped(N_Consumers);
+      std::vector<std::thread>      threads;
+
+      for (size_t c = 0; c < N_Consumers; ++c)
+      {
+        threads.push_back(std::thread([&buffer, &popped, c]()
+                                      {
+                                        int output[16];
+
+                                        while (popped[c].size() < size_t(Length))
+                                        {
+                                          size_t n = buffer.pop(c, etl::span<int>(output));
+
+                                          popped[c].insert(popped[c].end(), output, output + n);
+
+                                          if (n == 0U)
+                                          {
+                                            std::this_thread::yield();
+                                          }
+                                        }
+                                      }));
+      }
+
+      for (int i = 0; i < Length; ++i)
+      {
+        while (!buffer.push(i))
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      for (size_t t = 0; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      for (size_t c = 0; c < N_Consumers; ++c)
+      {
+        CHECK_EQUAL(size_t(Length), popped[c].size());
+
+        bool in_order = true;
+
+        for (size_t i = 0; i < popped[c].size(); ++i)
+        {
+          in_order = in_order && (popped[c][i] == int(i));
+        }
+
+        CHECK(in_order);
+      }
+    }
+  #endif
+  }
+} // namespace
+
+#endif
@@ -105,6 +105,47 @@ namespace etl
 
 namespace
 {
+  //***********************************
+  // Checks that writing and reading a range gives the same bytes and values
+  // as writing and reading each element, for lengths that exercise the
+  // blocks and the remainders.
+  template <typename T>
+  void check_range_matches_elements(etl::endian endianness)
+  {
+    for (size_t length = 0U; length < 40U; ++length)
+    {
+      std::vector<T> put_data(length);
+      std::vector<T> get_data(length);
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        put_data[i] = static_cast<T>((i + 1U) * 0x0102030405060708ULL);
+      }
+
+      std::vector<char> storage_range(length * sizeof(T) + 1U);
+      std::vector<char> storage_elements(length * sizeof(T) + 1U);
+
+      etl::byte_stream_writer writer_range(storage_range.data(), storage_range.size(), endianness);
+      etl::byte_stream_writer writer_elements(storage_elements.data(), storage_elements.size(), endianness);
+
+      CHECK(writer_range.write(etl::span<const T>(put_data.data(), put_data.size())));
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        CHECK(writer_elements.write(put_data[i]));
+      }
+
+      CHECK_EQUAL(writer_elements.size_bytes(), writer_range.size_bytes());
+      CHECK(std::equal(storage_elements.begin(), storage_elements.begin() + static_cast<ptrdiff_t>(writer_elements.size_bytes()), storage_range.begin()));
+
+      etl::byte_stream_reader reader(storage_range.data(), writer_range.size_bytes(), endianness);
+
+      CHECK(reader.read<T>(etl::span<T>(get_data.data(), get_data.size())).has_value());
+      CHECK(put_data == get_data);
+      CHECK(reader.empty());
+    }
+  }
+
   SUITE(test_byte_stream)
   {
     //*************************************************************************
@@ -1351,6 +1392,47 @@ namespace
         CHECK_EQUAL(expected[i], result[i]);
       }
     }
+
+    //*************************************************************************
+    TEST(write_read_ranges_match_elements)
+    {
+      check_range_matches_elements<int16_t>(etl::endian::big);
+      check_range_matches_elements<int16_t>(etl::endian::little);
+      check_range_matches_elements<uint32_t>(etl::endian::big);
+      check_range_matches_elements<uint32_t>(etl::endian::little);
+      check_range_matches_elements<int64_t>(etl::endian::big);
+      check_range_matches_elements<int64_t>(etl::endian::little);
+      check_range_matches_elements<float>(etl::endian::big);
+      check_range_matches_elements<double>(etl::endian::little);
+      check_range_matches_elements<uint8_t>(etl::endian::big);
+    }
+
+    //*************************************************************************
+    TEST(write_range_byte_stream_callback)
+    {
+      std::array<char, 4 * sizeof(int16_t)> storage;
+      std::array<int16_t, 4>                put_data = {int16_t(0x0001), int16_t(0xA55A), int16_t(0x1234), int16_t(0xFFFE)};
+      std::vector<char>                     expected = {char(0x00), char(0x01), char(0xA5), char(0x5A), char(0x12), char(0x34), char(0xFF), char(0xFE)};
+
+      std::vector<char> result;
+      size_t            calls = 0U;
+
+      auto lambda = [&](etl::byte_stream_writer::callback_parameter_type sp)
+      {
+        ++calls;
+        std::copy(sp.begin(), sp.end(), std::back_inserter(result));
+      };
+
+      etl::byte_stream_writer::callback_type callback(lambda);
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big, callback);
+
+      // The callback is called once for the range.
+      CHECK(writer.write(put_data.data(), put_data.size()));
+      CHECK_EQUAL(1U, calls);
+      CHECK(expected == result);
+    }
+
     //*************************************************************************
     TEST(read_byte_stream_skip)
     {
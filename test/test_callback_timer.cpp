@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/callback_timer.h"
 #include "etl/function.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <thread>
@@ -142,6 +143,35 @@ namespace
     free_tick_list2.push_back(ticks);
   }
 
+  //***************************************************************************
+  // Free function callbacks that record the order of the calls.
+  //***************************************************************************
+  std::vector<int> batch_order;
+
+  etl::icallback_timer* p_batch_controller = nullptr;
+  etl::timer::id::type  batch_stop_id      = etl::timer::id::NO_TIMER;
+
+  void batch_callback1()
+  {
+    batch_order.push_back(1);
+  }
+
+  void batch_callback2()
+  {
+    batch_order.push_back(2);
+  }
+
+  void batch_callback3()
+  {
+    batch_order.push_back(3);
+  }
+
+  void batch_callback_stop()
+  {
+    batch_order.push_back(4);
+    p_batch_controller->stop(batch_stop_id);
+  }
+
   SUITE(test_callback_timer)
   {
     //*************************************************************************
@@ -850,6 +880,202 @@ namespace
       CHECK_EQUAL(3, timerInsertRemoveTest.removed);
     }
 
+    //*************************************************************************
+    TEST(callback_timer_tick_batch_calls_in_due_order)
+    {
+      etl::callback_timer_batched<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(batch_callback3, 37, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(batch_callback2, 23, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id3 = timer_controller.register_timer(batch_callback1, 11, etl::timer::mode::Single_Shot);
+
+      batch_order.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.start(id3);
+
+      CHECK_FALSE(timer_controller.tick_batch(40));
+
+      timer_controller.enable(true);
+
+      CHECK_TRUE(timer_controller.tick_batch(30));
+      CHECK_EQUAL(7U, timer_controller.time_to_next());
+
+      CHECK_TRUE(timer_controller.tick_batch(10));
+
+      std::vector<int> compare = {1, 2, 3};
+
+      CHECK_EQUAL(compare.size(), batch_order.size());
+      CHECK_ARRAY_EQUAL(compare.data(), batch_order.data(), compare.size());
+      CHECK_FALSE(timer_controller.has_active_timer());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_tick_batch_matches_tick_for_single_steps)
+    {
+      etl::callback_timer_batched<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback, 37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback, 23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_callback2, 11, etl::timer::mode::Repeating);
+
+      object.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      while (ticks <= 100U)
+      {
+        ++ticks;
+        timer_controller.tick_batch(1U);
+      }
+
+      std::vector<uint64_t> compare1 = {37, 74};
+      std::vector<uint64_t> compare2 = {23, 46, 69, 92};
+      std::vector<uint64_t> compare3 = {11, 22, 33, 44, 55, 66, 77, 88, 99};
+
+      CHECK_EQUAL(compare1.size(), object.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), object.tick_list.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_tick_batch_repeating_called_once_and_keeps_phase)
+    {
+      etl::callback_timer_batched<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(batch_callback1, 10, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(batch_callback2, 4, etl::timer::mode::Repeating);
+
+      batch_order.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.enable(true);
+
+      // id2 was due at 4, 8, 12... and id1 at 10, 20, 30.
+      timer_controller.tick_batch(35);
+
+      std::vector<int> compare = {2, 1};
+
+      CHECK_EQUAL(compare.size(), batch_order.size());
+      CHECK_ARRAY_EQUAL(compare.data(), batch_order.data(), compare.size());
+
+      // Next due at 36 and 40.
+      CHECK_EQUAL(1U, timer_controller.time_to_next());
+
+      timer_controller.tick(1);
+      CHECK_EQUAL(3U, batch_order.size());
+
+      timer_controller.tick(4);
+      CHECK_EQUAL(5U, batch_order.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_tick_batch_coalesce)
+    {
+      etl::callback_timer_batched<4> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(batch_callback1, 10, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(batch_callback1, 10, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(batch_callback1, 20, etl::timer::mode::Repeating);
+      etl::timer::id::type id4 = timer_controller.register_timer(batch_callback2, 10, etl::timer::mode::Repeating);
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.start(id3);
+      timer_controller.start(id4);
+      timer_controller.enable(true);
+
+      // Each timer called.
+      batch_order.clear();
+      timer_controller.tick_batch(20);
+
+      CHECK_EQUAL(4U, batch_order.size());
+      CHECK_EQUAL(3, std::count(batch_order.begin(), batch_order.end(), 1));
+      CHECK_EQUAL(1, std::count(batch_order.begin(), batch_order.end(), 2));
+
+      // Timers with the same callback and period called once.
+      batch_order.clear();
+      timer_controller.tick_batch(20, true);
+
+      CHECK_EQUAL(3U, batch_order.size());
+      CHECK_EQUAL(2, std::count(batch_order.begin(), batch_order.end(), 1));
+      CHECK_EQUAL(1, std::count(batch_order.begin(), batch_order.end(), 2));
+
+      // All still running.
+      CHECK_TRUE(timer_controller.is_active(id1));
+      CHECK_TRUE(timer_controller.is_active(id2));
+      CHECK_TRUE(timer_controller.is_active(id3));
+      CHECK_TRUE(timer_controller.is_active(id4));
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_tick_batch_callback_stops_later_timer)
+    {
+      etl::callback_timer_batched<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(batch_callback_stop, 5, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(batch_callback2, 10, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(batch_callback3, 15, etl::timer::mode::Single_Shot);
+
+      p_batch_controller = &timer_controller;
+      batch_stop_id      = id2;
+
+      batch_order.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.start(id3);
+      timer_controller.enable(true);
+
+      timer_controller.tick_batch(20);
+
+      std::vector<int> compare = {4, 3};
+
+      CHECK_EQUAL(compare.size(), batch_order.size());
+      CHECK_ARRAY_EQUAL(compare.data(), batch_order.data(), compare.size());
+      CHECK_FALSE(timer_controller.has_active_timer());
+
+      p_batch_controller = nullptr;
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_tick_batch_without_buffer_calls_tick)
+    {
+      etl::callback_timer<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(batch_callback1, 10, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(batch_callback2, 4, etl::timer::mode::Repeating);
+
+      batch_order.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.enable(true);
+
+      // As tick, each timer is called every time that it was due.
+      CHECK_TRUE(timer_controller.tick_batch(21, true));
+
+      std::vector<int> compare = {2, 2, 1, 2, 2, 2, 1};
+
+      CHECK_EQUAL(compare.size(), batch_order.size());
+      CHECK_ARRAY_EQUAL(compare.data(), batch_order.data(), compare.size());
+      CHECK_EQUAL(3U, timer_controller.time_to_next());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
 
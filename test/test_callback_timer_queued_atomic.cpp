@@ -0,0 +1,287 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/callback_timer_queued_atomic.h"
+#include "etl/delegate.h"
+
+#if ETL_HAS_ATOMIC
+
+  #include <atomic>
+  #include <thread>
+  #include <vector>
+
+  #define REALTIME_TEST 0
+
+namespace
+{
+  uint64_t ticks = 0ULL;
+
+  using timer_type    = etl::callback_timer_queued_atomic<4, std::atomic_uint32_t>;
+  using callback_type = timer_type::callback_type;
+
+  //***************************************************************************
+  std::vector<uint64_t> tick_list1;
+
+  void free_callback1()
+  {
+    tick_list1.push_back(ticks);
+  }
+
+  //***************************************************************************
+  std::vector<uint64_t> tick_list2;
+
+  void free_callback2()
+  {
+    tick_list2.push_back(ticks);
+  }
+
+  callback_type callback1 = callback_type::create<free_callback1>();
+  callback_type callback2 = callback_type::create<free_callback2>();
+
+  //***************************************************************************
+  void run_ticks(timer_type& timer_controller, uint64_t last_tick)
+  {
+    while (ticks < last_tick)
+    {
+      ++ticks;
+      timer_controller.tick_queued(1U);
+    }
+  }
+
+  SUITE(test_callback_timer_queued_atomic)
+  {
+    //*************************************************************************
+    TEST(callback_timer_queued_atomic_start_is_applied_by_tick)
+    {
+      timer_type timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(callback1, 10, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(callback2, 15, etl::timer::mode::Single_Shot);
+
+      tick_list1.clear();
+      tick_list2.clear();
+
+      timer_controller.enable(true);
+
+      CHECK_TRUE(timer_controller.queue_start(id1));
+      CHECK_TRUE(timer_controller.queue_start(id2));
+
+      // Not started until the next tick.
+      CHECK_FALSE(timer_controller.is_active(id1));
+      CHECK_FALSE(timer_controller.is_active(id2));
+
+      ticks = 0U;
+      run_ticks(timer_controller, 40U);
+
+      std::vector<uint64_t> compare1 = {10, 20, 30, 40};
+      std::vector<uint64_t> compare2 = {15};
+
+      CHECK_EQUAL(compare1.size(), tick_list1.size());
+      CHECK_EQUAL(compare2.size(), tick_list2.size());
+      CHECK_ARRAY_EQUAL(compare1.data(), tick_list1.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), tick_list2.data(), compare2.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_queued_atomic_stop_is_applied_by_tick)
+    {
+      timer_type timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(callback1, 10, etl::timer::mode::Repeating);
+
+      tick_list1.clear();
+
+      timer_controller.enable(true);
+      timer_controller.start(id1);
+
+      ticks = 0U;
+      run_ticks(timer_controller, 25U);
+
+      CHECK_TRUE(timer_controller.queue_stop(id1));
+      CHECK_TRUE(timer_controller.is_active(id1));
+
+      run_ticks(timer_controller, 50U);
+
+      CHECK_FALSE(timer_controller.is_active(id1));
+
+      std::vector<uint64_t> compare1 = {10, 20};
+
+      CHECK_EQUAL(compare1.size(), tick_list1.size());
+      CHECK_ARRAY_EQUAL(compare1.data(), tick_list1.data(), compare1.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_queued_atomic_immediate)
+    {
+      timer_type timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(callback1, 10, etl::timer::mode::Single_Shot);
+
+      tick_list1.clear();
+
+      timer_controller.enable(true);
+      timer_controller.queue_start(id1, etl::timer::start::Immediate);
+
+      ticks = 0U;
+      timer_controller.tick_queued(0U);
+
+      std::vector<uint64_t> compare1 = {0};
+
+      CHECK_EQUAL(compare1.size(), tick_list1.size());
+      CHECK_ARRAY_EQUAL(compare1.data(), tick_list1.data(), compare1.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_queued_atomic_last_request_wins)
+    {
+      timer_type timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(callback1, 10, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(callback2, 10, etl::timer::mode::Repeating);
+
+      timer_controller.enable(true);
+
+      timer_controller.queue_start(id1);
+      timer_controller.queue_stop(id1);
+
+      timer_controller.queue_stop(id2);
+      timer_controller.queue_start(id2);
+      timer_controller.queue_start(id2);
+
+      timer_controller.tick_queued(1U);
+
+      CHECK_FALSE(timer_controller.is_active(id1));
+      CHECK_TRUE(timer_controller.is_active(id2));
+
+      // Applied without a tick.
+      timer_controller.queue_stop(id2);
+      timer_controller.apply_commands();
+
+      CHECK_FALSE(timer_controller.has_active_timer());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_queued_atomic_requests_while_disabled)
+    {
+      timer_type timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(callback1, 10, etl::timer::mode::Repeating);
+
+      timer_controller.queue_start(id1);
+
+      CHECK_FALSE(timer_controller.tick_queued(1U));
+      CHECK_TRUE(timer_controller.is_active(id1));
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_queued_atomic_invalid_id)
+    {
+      timer_type timer_controller;
+
+      CHECK_FALSE(timer_controller.queue_start(4));
+      CHECK_FALSE(timer_controller.queue_stop(etl::timer::id::NO_TIMER));
+    }
+
+    //*************************************************************************
+  #if REALTIME_TEST
+    TEST(callback_timer_queued_atomic_threads)
+    {
+      static etl::callback_timer_queued_atomic<64, std::atomic_uint32_t> controller;
+
+      callback_type callback = callback_type::create<free_callback1>();
+
+      for (uint32_t i = 0U; i < 64U; ++i)
+      {
+        controller.register_timer(callback, 1U + (i % 7U), etl::timer::mode::Repeating);
+      }
+
+      controller.enable(true);
+
+      std::atomic<bool>        running(true);
+      std::vector<std::thread> producers;
+
+      for (int p = 0; p < 4; ++p)
+      {
+        producers.push_back(std::thread([&running, p]()
+        {
+          uint32_t random = 12345U + uint32_t(p);
+
+          while (running.load())
+          {
+            random = (random * 1103515245U) + 12345U;
+
+            const etl::timer::id::type id = static_cast<etl::timer::id::type>((random >> 8) % 64U);
+
+            if ((random >> 20) & 1U)
+            {
+              controller.queue_start(id);
+            }
+            else
+            {
+              controller.queue_stop(id);
+            }
+          }
+        }));
+      }
+
+      size_t skipped = 0U;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        if (!controller.tick_queued(1U))
+        {
+          ++skipped;
+        }
+      }
+
+      running.store(false);
+
+      for (size_t p = 0U; p < producers.size(); ++p)
+      {
+        producers[p].join();
+      }
+
+      CHECK_EQUAL(0U, skipped);
+
+      for (etl::timer::id::type id = 0U; id < 64U; ++id)
+      {
+        controller.queue_stop(id);
+      }
+
+      controller.tick_queued(0U);
+
+      CHECK_FALSE(controller.has_active_timer());
+    }
+  #endif
+  }
+} // namespace
+
+#endif
@@ -27,6 +27,7 @@ SOFTWARE.
 ******************************************************************************/
 
 #include "unit_test_framework.h"
+#include "random_test_data.h"
 
 #include <iterator>
 #include <stdint.h>
@@ -316,5 +317,61 @@ namespace
       uint32_t crc3 = etl::crc32_c_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Hardware, or the 256 entry table if the target has no CRC32C instructions.
+    //*************************************************************************
+    TEST(test_crc32_c_hardware)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_c_hardware(data.begin(), data.end());
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_hardware_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_c_hardware crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(static_cast<uint8_t>(data[i]));
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_hardware_random_buffers)
+    {
+      const std::vector<uint8_t> data = make_random_data(1024U, 1U);
+
+      // Every alignment, and lengths either side of the block sizes.
+      for (size_t offset = 0UL; offset < 8UL; ++offset)
+      {
+        for (size_t length = 0UL; length < 40UL; ++length)
+        {
+          const uint8_t* begin = data.data() + offset;
+          const uint8_t* end   = begin + length;
+
+          CHECK_EQUAL(uint32_t(etl::crc32_c_t256(begin, end)), uint32_t(etl::crc32_c_hardware(begin, end)));
+        }
+      }
+
+      const uint8_t* begin = data.data() + 3U;
+      const uint8_t* end   = data.data() + data.size();
+
+      etl::crc32_c_hardware crc_calculator;
+      crc_calculator.add(begin, begin + 100U);
+      crc_calculator.add(begin + 100U, end);
+
+      CHECK_EQUAL(uint32_t(etl::crc32_c_t256(begin, end)), crc_calculator.value());
+    }
   }
 } // namespace
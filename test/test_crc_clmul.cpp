@@ -0,0 +1,136 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+#include "random_test_data.h"
+
+#include <stdint.h>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "etl/crc32.h"
+#include "etl/crc32_bzip2.h"
+#include "etl/crc32_c.h"
+#include "etl/crc32_mpeg2.h"
+#include "etl/crc64_ecma.h"
+#include "etl/crc64_iso.h"
+
+namespace
+{
+  //*************************************************************************
+  // Checks that the carry-less multiply CRC gives the same results as the
+  // 256 entry table, for lengths either side of each fold size, at each
+  // alignment, and for ranges split at unaligned positions.
+  template <typename TReference, typename TClmul>
+  bool clmul_matches_table()
+  {
+    const std::vector<uint8_t> data = make_random_data(5000UL);
+
+    for (size_t offset = 0UL; offset < 16UL; ++offset)
+    {
+      for (size_t length = 0UL; length <= 300UL; ++length)
+      {
+        const uint8_t* p = data.data() + offset;
+
+        const typename TReference::value_type expected = TReference(p, p + length).value();
+
+        if (TClmul(p, p + length).value() != expected)
+        {
+          return false;
+        }
+
+        TClmul crc;
+        crc.add(p, p + (length / 3UL));
+        crc.add(p + (length / 3UL), p + length);
+
+        if (crc.value() != expected)
+        {
+          return false;
+        }
+      }
+    }
+
+    const uint8_t* p = data.data();
+
+    if (TClmul(p, p + data.size()).value() != TReference(p, p + data.size()).value())
+    {
+      return false;
+    }
+
+    // Non-contiguous ranges are added a byte at a time.
+    const std::list<uint8_t> list(data.begin(), data.end());
+
+    return TClmul(list.begin(), list.end()).value() == TReference(p, p + data.size()).value();
+  }
+
+  SUITE(test_crc_clmul)
+  {
+    //*************************************************************************
+    TEST(test_check_values)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0xCBF43926UL, uint32_t(etl::crc32_clmul(data.c_str(), data.c_str() + data.size())));
+      CHECK_EQUAL(0xE3069283UL, uint32_t(etl::crc32_c_clmul(data.c_str(), data.c_str() + data.size())));
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, uint64_t(etl::crc64_ecma_clmul(data.c_str(), data.c_str() + data.size())));
+    }
+
+    //*************************************************************************
+    TEST(test_clmul_matches_table)
+    {
+      CHECK_TRUE((clmul_matches_table<etl::crc32, etl::crc32_clmul>()));
+      CHECK_TRUE((clmul_matches_table<etl::crc32_c, etl::crc32_c_clmul>()));
+      CHECK_TRUE((clmul_matches_table<etl::crc64_ecma, etl::crc64_ecma_clmul>()));
+    }
+
+#if ETL_USING_CRC_CLMUL
+    //*************************************************************************
+    TEST(test_other_parameters)
+    {
+      CHECK_TRUE((clmul_matches_table<etl::crc32_bzip2, etl::crc_clmul_type<etl::private_crc::crc32_bzip2_parameters> >()));
+      CHECK_TRUE((clmul_matches_table<etl::crc32_mpeg2, etl::crc_clmul_type<etl::private_crc::crc32_mpeg2_parameters> >()));
+      CHECK_TRUE((clmul_matches_table<etl::crc64_iso, etl::crc_clmul_type<etl::private_crc::crc64_iso_parameters> >()));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_add_values)
+    {
+      const std::vector<uint8_t> data = make_random_data(100UL, 1U);
+
+      etl::crc32_c_clmul crc;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc.add(data[i]);
+      }
+
+      CHECK_EQUAL(etl::crc32_c(data.begin(), data.end()).value(), crc.value());
+    }
+  }
+} // namespace
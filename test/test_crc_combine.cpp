@@ -0,0 +1,165 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+#include "random_test_data.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "etl/crc_combine.h"
+#include "etl/crc16_ccitt.h"
+#include "etl/crc16_kermit.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc32_mpeg2.h"
+#include "etl/crc64_ecma.h"
+#include "etl/crc8_ccitt.h"
+#include "etl/crc8_rohc.h"
+
+namespace
+{
+  //*************************************************************************
+  // Checks crc_combine for every split of a buffer.
+  template <typename TCrc>
+  bool combine_matches_whole()
+  {
+    const std::vector<uint8_t> data = make_random_data(150UL);
+    const uint8_t*             p    = data.data();
+
+    for (size_t length = 0UL; length <= data.size(); length += 15UL)
+    {
+      const typename TCrc::value_type whole = TCrc(p, p + length).value();
+
+      for (size_t split = 0UL; split <= length; ++split)
+      {
+        const typename TCrc::value_type crc_a = TCrc(p, p + split).value();
+        const typename TCrc::value_type crc_b = TCrc(p + split, p + length).value();
+
+        if (etl::crc_combine<TCrc>(crc_a, crc_b, length - split) != whole)
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_crc_combine)
+  {
+    //*************************************************************************
+    TEST(test_check_value)
+    {
+      std::string a("1234");
+      std::string b("56789");
+
+      uint32_t crc_a = etl::crc32(a.begin(), a.end());
+      uint32_t crc_b = etl::crc32(b.begin(), b.end());
+
+      CHECK_EQUAL(0xCBF43926UL, etl::crc_combine<etl::crc32>(crc_a, crc_b, b.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_8_bit)
+    {
+      CHECK_TRUE(combine_matches_whole<etl::crc8_ccitt>());
+      CHECK_TRUE(combine_matches_whole<etl::crc8_rohc>());
+    }
+
+    //*************************************************************************
+    TEST(test_16_bit)
+    {
+      CHECK_TRUE(combine_matches_whole<etl::crc16_ccitt>());
+      CHECK_TRUE(combine_matches_whole<etl::crc16_kermit>());
+    }
+
+    //*************************************************************************
+    TEST(test_32_bit)
+    {
+      CHECK_TRUE(combine_matches_whole<etl::crc32>());
+      CHECK_TRUE(combine_matches_whole<etl::crc32_c>());
+      CHECK_TRUE(combine_matches_whole<etl::crc32_mpeg2>());
+      CHECK_TRUE(combine_matches_whole<etl::crc32_c_hardware>());
+    }
+
+    //*************************************************************************
+    TEST(test_64_bit)
+    {
+      CHECK_TRUE(combine_matches_whole<etl::crc64_ecma>());
+    }
+
+    //*************************************************************************
+    TEST(test_large_length)
+    {
+      // One megabyte of zeros.
+      const std::vector<uint8_t> data(1024UL * 1024UL);
+
+      const uint32_t crc_a = etl::crc32_c(data.begin(), data.begin() + 1000);
+      const uint32_t crc_b = etl::crc32_c(data.begin() + 1000, data.end());
+
+      CHECK_EQUAL(etl::crc32_c(data.begin(), data.end()).value(), etl::crc_combine<etl::crc32_c>(crc_a, crc_b, data.size() - 1000UL));
+    }
+
+    //*************************************************************************
+    TEST(test_patch_header)
+    {
+      std::vector<uint8_t> data = make_random_data(64UL);
+
+      const size_t header_length = 8UL;
+      const size_t body_length   = data.size() - header_length;
+
+      const uint32_t old_crc        = etl::crc32(data.begin(), data.end());
+      const uint32_t old_header_crc = etl::crc32(data.begin(), data.begin() + header_length);
+
+      data[2] ^= 0x5AU;
+
+      const uint32_t new_header_crc = etl::crc32(data.begin(), data.begin() + header_length);
+
+      // Recover the CRC of the body, then combine it with the new header.
+      const uint32_t body_crc = old_crc ^ etl::crc_combine<etl::crc32>(old_header_crc, 0U, body_length);
+      const uint32_t new_crc  = etl::crc_combine<etl::crc32>(new_header_crc, body_crc, body_length);
+
+      CHECK_EQUAL(etl::crc32(data.begin(), data.end()).value(), new_crc);
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint32_t crc_a  = etl::crc32(data, data + 4);
+      constexpr uint32_t crc_b  = etl::crc32(data + 4, data + 9);
+      constexpr uint32_t crc    = etl::crc_combine<etl::crc32>(crc_a, crc_b, 5U);
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+#endif
+  }
+} // namespace
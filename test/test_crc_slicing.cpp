@@ -0,0 +1,171 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+#include "random_test_data.h"
+
+#include <stdint.h>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "etl/crc16_ccitt.h"
+#include "etl/crc16_kermit.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc32_mpeg2.h"
+#include "etl/crc64_ecma.h"
+#include "etl/crc64_iso.h"
+#include "etl/crc8_ccitt.h"
+#include "etl/crc8_rohc.h"
+
+#if ETL_USING_CPP14
+
+namespace
+{
+  //*************************************************************************
+  // Checks that the slicing tables give the same results as the 256 entry
+  // table, for lengths either side of each slice size, and for ranges split
+  // at unaligned positions.
+  template <typename TParameters, size_t Table_Size>
+  bool slicing_matches_table()
+  {
+    typedef etl::crc_type<TParameters, 256U>        reference_t;
+    typedef etl::crc_type<TParameters, Table_Size>  sliced_t;
+
+    for (size_t length = 0UL; length <= 70UL; ++length)
+    {
+      const std::vector<uint8_t> data = make_random_data(length, uint32_t(length));
+      const uint8_t*             p    = data.data();
+
+      const typename reference_t::value_type expected = reference_t(p, p + length).value();
+
+      if (sliced_t(p, p + length).value() != expected)
+      {
+        return false;
+      }
+
+      sliced_t crc;
+      crc.add(p, p + (length / 3UL));
+      crc.add(p + (length / 3UL), p + length);
+
+      if (crc.value() != expected)
+      {
+        return false;
+      }
+
+      // Non-contiguous ranges are added a byte at a time.
+      const std::list<uint8_t> list(data.begin(), data.end());
+
+      if (sliced_t(list.begin(), list.end()).value() != expected)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  template <typename TParameters>
+  bool all_slicing_matches_table()
+  {
+    return slicing_matches_table<TParameters, 1024U>() && slicing_matches_table<TParameters, 2048U>() &&
+           slicing_matches_table<TParameters, 4096U>();
+  }
+
+  SUITE(test_crc_slicing)
+  {
+    //*************************************************************************
+    TEST(test_check_values)
+    {
+      std::string data("123456789");
+
+      CHECK_EQUAL(0xE3069283UL, uint32_t(etl::crc32_c_t<1024U>(data.c_str(), data.c_str() + data.size())));
+      CHECK_EQUAL(0xE3069283UL, uint32_t(etl::crc32_c_t<2048U>(data.c_str(), data.c_str() + data.size())));
+      CHECK_EQUAL(0xE3069283UL, uint32_t(etl::crc32_c_t<4096U>(data.c_str(), data.c_str() + data.size())));
+      CHECK_EQUAL(0xCBF43926UL, uint32_t(etl::crc32_t<2048U>(data.c_str(), data.c_str() + data.size())));
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, uint64_t(etl::crc64_ecma_t<2048U>(data.c_str(), data.c_str() + data.size())));
+    }
+
+    //*************************************************************************
+    TEST(test_8_bit)
+    {
+      CHECK_TRUE(all_slicing_matches_table<etl::private_crc::crc8_ccitt_parameters>());
+      CHECK_TRUE(all_slicing_matches_table<etl::private_crc::crc8_rohc_parameters>());
+    }
+
+    //*************************************************************************
+    TEST(test_16_bit)
+    {
+      CHECK_TRUE(all_slicing_matches_table<etl::private_crc::crc16_ccitt_parameters>());
+      CHECK_TRUE(all_slicing_matches_table<etl::private_crc::crc16_kermit_parameters>());
+    }
+
+    //*************************************************************************
+    TEST(test_32_bit)
+    {
+      CHECK_TRUE(all_slicing_matches_table<etl::private_crc::crc32_parameters>());
+      CHECK_TRUE(all_slicing_matches_table<etl::private_crc::crc32_c_parameters>());
+      CHECK_TRUE(all_slicing_matches_table<etl::private_crc::crc32_mpeg2_parameters>());
+    }
+
+    //*************************************************************************
+    TEST(test_64_bit)
+    {
+      CHECK_TRUE(all_slicing_matches_table<etl::private_crc::crc64_ecma_parameters>());
+      CHECK_TRUE(all_slicing_matches_table<etl::private_crc::crc64_iso_parameters>());
+    }
+
+    //*************************************************************************
+    TEST(test_add_values)
+    {
+      const std::vector<uint8_t> data = make_random_data(100UL, 1U);
+
+      etl::crc32_c_t<4096U> crc;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc.add(data[i]);
+      }
+
+      CHECK_EQUAL(etl::crc32_c(data.begin(), data.end()).value(), crc.value());
+    }
+
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      constexpr char     data[] = "123456789";
+      constexpr uint32_t crc    = etl::crc32_c_t<2048U>(data, data + 9);
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+  }
+} // namespace
+
+#endif
@@ -63,6 +63,11 @@ namespace
       CHECK_EQUAL((ETL_USING_INTEL_COMPILER == 1), etl::traits::using_intel_compiler);
       CHECK_EQUAL((ETL_USING_TEXAS_INSTRUMENTS_COMPILER == 1), etl::traits::using_texas_instruments_compiler);
       CHECK_EQUAL((ETL_USING_GENERIC_COMPILER == 1), etl::traits::using_generic_compiler);
+      CHECK_EQUAL((ETL_USING_SSSE3 == 1), etl::traits::using_ssse3);
+      CHECK_EQUAL((ETL_USING_SSE42 == 1), etl::traits::using_sse42);
+      CHECK_EQUAL((ETL_USING_PCLMUL == 1), etl::traits::using_pclmul);
+      CHECK_EQUAL((ETL_USING_ARM_CRC32 == 1), etl::traits::using_arm_crc32);
+      CHECK_EQUAL((ETL_USING_ARM_PMULL == 1), etl::traits::using_arm_pmull);
       CHECK_EQUAL((ETL_USING_8BIT_TYPES == 1), etl::traits::has_8bit_types);
       CHECK_EQUAL((ETL_USING_64BIT_TYPES == 1), etl::traits::has_64bit_types);
 
@@ -0,0 +1,238 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "etl/const_map.h"
+#include "etl/eytzinger_index.h"
+#include "etl/flat_map.h"
+
+namespace
+{
+  static const size_t Max_Size = 100UL;
+
+  typedef etl::flat_map<int, int, Max_Size>         FlatMap;
+  typedef etl::eytzinger_index<int, int, Max_Size>  Index;
+
+  //*************************************************************************
+  // Fills the map with the even numbers from 0.
+  void fill(FlatMap& map, size_t n)
+  {
+    map.clear();
+
+    for (size_t i = 0UL; i < n; ++i)
+    {
+      map.insert(FlatMap::value_type(int(i * 2UL), int(i)));
+    }
+  }
+
+  SUITE(test_eytzinger_index)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Index index;
+
+      CHECK_TRUE(index.empty());
+      CHECK_EQUAL(0UL, index.size());
+      CHECK_EQUAL(Max_Size, index.max_size());
+      CHECK_TRUE(index.find(0) == ETL_NULLPTR);
+      CHECK_TRUE(index.lower_bound(0) == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_find_every_size)
+    {
+      FlatMap map;
+
+      // Every size exercises a differently shaped last level of the tree.
+      for (size_t n = 0UL; n <= Max_Size; ++n)
+      {
+        fill(map, n);
+
+        Index index(map);
+
+        CHECK_EQUAL(n, index.size());
+
+        for (int key = -1; key <= int(n * 2UL); ++key)
+        {
+          const Index::value_type* p_found = index.find(key);
+
+          FlatMap::const_iterator itr = map.find(key);
+
+          if (itr == map.end())
+          {
+            CHECK_TRUE(p_found == ETL_NULLPTR);
+            CHECK_FALSE(index.contains(key));
+          }
+          else
+          {
+            CHECK_TRUE(p_found == &*itr);
+            CHECK_TRUE(index.contains(key));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_lower_bound_every_size)
+    {
+      FlatMap map;
+
+      for (size_t n = 0UL; n <= Max_Size; ++n)
+      {
+        fill(map, n);
+
+        Index index(map);
+
+        for (int key = -1; key <= int(n * 2UL); ++key)
+        {
+          const Index::value_type* p_found = index.lower_bound(key);
+
+          FlatMap::const_iterator itr = map.lower_bound(key);
+
+          if (itr == map.end())
+          {
+            CHECK_TRUE(p_found == ETL_NULLPTR);
+          }
+          else
+          {
+            CHECK_TRUE(p_found == &*itr);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_rebuild_after_modification)
+    {
+      FlatMap map;
+      fill(map, 10UL);
+
+      Index index(map);
+      CHECK_TRUE(index.contains(4));
+
+      map.erase(4);
+      map.insert(FlatMap::value_type(5, 50));
+      index.build(map);
+
+      CHECK_FALSE(index.contains(4));
+      CHECK_TRUE(index.contains(5));
+      CHECK_EQUAL(50, index.find(5)->second);
+      CHECK_EQUAL(10UL, index.size());
+
+      index.clear();
+      CHECK_TRUE(index.empty());
+      CHECK_FALSE(index.contains(5));
+    }
+
+    //*************************************************************************
+    TEST(test_build_too_many_elements)
+    {
+      FlatMap map;
+      fill(map, 10UL);
+
+      CHECK_THROW((etl::eytzinger_index<int, int, 4>(map)), etl::eytzinger_index_full);
+
+      etl::eytzinger_index<int, int, 4> index;
+      CHECK_THROW(index.build(map), etl::eytzinger_index_full);
+
+      // A range that fits is accepted.
+      index.build(map.begin(), map.find(8));
+      CHECK_EQUAL(4UL, index.size());
+    }
+
+    //*************************************************************************
+    TEST(test_greater_compare)
+    {
+      typedef etl::flat_map<int, int, 20, etl::greater<int> >        GreaterMap;
+      typedef etl::eytzinger_index<int, int, 20, etl::greater<int> > GreaterIndex;
+
+      GreaterMap map;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        map.insert(GreaterMap::value_type(i * 3, i));
+      }
+
+      GreaterIndex index(map);
+
+      for (int key = -1; key < 62; ++key)
+      {
+        GreaterMap::const_iterator itr = map.lower_bound(key);
+
+        CHECK_TRUE(index.lower_bound(key) == ((itr == map.end()) ? ETL_NULLPTR : &*itr));
+        CHECK_EQUAL((key % 3) == 0 && key >= 0 && key < 60, index.contains(key));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_const_map)
+    {
+      typedef etl::const_map<int, char, 6> ConstMap;
+
+      static const ConstMap map{ConstMap::value_type{1, 'a'}, ConstMap::value_type{3, 'b'}, ConstMap::value_type{5, 'c'},
+                                ConstMap::value_type{7, 'd'}, ConstMap::value_type{9, 'e'}, ConstMap::value_type{11, 'f'}};
+
+      const etl::eytzinger_index<int, char, 6> index(map);
+
+      CHECK_EQUAL(6UL, index.size());
+      CHECK_EQUAL('a', index.find(1)->second);
+      CHECK_EQUAL('d', index.find(7)->second);
+      CHECK_EQUAL('f', index.find(11)->second);
+      CHECK_TRUE(index.find(4) == ETL_NULLPTR);
+      CHECK_EQUAL('c', index.lower_bound(4)->second);
+      CHECK_TRUE(index.lower_bound(12) == ETL_NULLPTR);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr_const_map)
+    {
+      typedef etl::const_map<int, char, 4>       ConstMap;
+      typedef etl::eytzinger_index<int, char, 4> ConstIndex;
+
+      static constexpr ConstMap map{ConstMap::value_type{10, 'a'}, ConstMap::value_type{20, 'b'},
+                                    ConstMap::value_type{30, 'c'}, ConstMap::value_type{40, 'd'}};
+
+      static constexpr ConstIndex index(map);
+
+      static constexpr char found      = index.find(30)->second;
+      static constexpr bool contains   = index.contains(25);
+      static constexpr char next       = index.lower_bound(25)->second;
+
+      CHECK_EQUAL('c', found);
+      CHECK_FALSE(contains);
+      CHECK_EQUAL('c', next);
+    }
+#endif
+  }
+} // namespace
@@ -0,0 +1,112 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <stdint.h>
+#include <string>
+
+#include "etl/crc16_ccitt.h"
+#include "etl/crc32_c.h"
+#include "etl/crc64_ecma.h"
+#include "etl/fnv_1.h"
+#include "etl/hash_of.h"
+#include "etl/jenkins.h"
+#include "etl/murmur3.h"
+
+namespace
+{
+  SUITE(test_hash_of)
+  {
+    //*************************************************************************
+    TEST(test_runtime)
+    {
+      std::string data("topic/x");
+
+      CHECK_EQUAL(etl::crc32_c(data.begin(), data.end()).value(), etl::hash_of<etl::crc32_c>("topic/x"));
+      CHECK_EQUAL(etl::crc32_c(data.begin(), data.end()).value(), etl::hash_of<etl::crc32_c>(data.c_str(), data.size()));
+      CHECK_EQUAL(etl::fnv_1a_32(data.begin(), data.end()).value(), etl::hash_of<etl::fnv_1a_32>("topic/x"));
+      CHECK_EQUAL(etl::jenkins(data.begin(), data.end()).value(), etl::hash_of<etl::jenkins>("topic/x"));
+      CHECK_EQUAL(etl::murmur3<uint32_t>(data.begin(), data.end()).value(), etl::hash_of<etl::murmur3<uint32_t> >("topic/x"));
+    }
+
+#if ETL_USING_CPP14 && !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      std::string data("123456789");
+
+      constexpr uint16_t crc16_ccitt = etl::hash_of<etl::crc16_ccitt>("123456789");
+      constexpr uint32_t crc32_c     = etl::hash_of<etl::crc32_c>("123456789");
+      constexpr uint64_t crc64_ecma  = etl::hash_of<etl::crc64_ecma>("123456789");
+      constexpr uint32_t fnv_1_32    = etl::hash_of<etl::fnv_1_32>("123456789");
+      constexpr uint32_t fnv_1a_32   = etl::hash_of<etl::fnv_1a_32>("123456789");
+      constexpr uint64_t fnv_1_64    = etl::hash_of<etl::fnv_1_64>("123456789");
+      constexpr uint64_t fnv_1a_64   = etl::hash_of<etl::fnv_1a_64>("123456789");
+      constexpr uint32_t murmur3_32  = etl::hash_of<etl::murmur3<uint32_t>>("123456789");
+
+      CHECK_EQUAL(0x29B1U, crc16_ccitt);
+      CHECK_EQUAL(0xE3069283UL, crc32_c);
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL, crc64_ecma);
+      CHECK_EQUAL(0x24148816UL, fnv_1_32);
+      CHECK_EQUAL(etl::fnv_1a_32(data.begin(), data.end()).value(), fnv_1a_32);
+      CHECK_EQUAL(etl::fnv_1_64(data.begin(), data.end()).value(), fnv_1_64);
+      CHECK_EQUAL(etl::fnv_1a_64(data.begin(), data.end()).value(), fnv_1a_64);
+      CHECK_EQUAL(etl::murmur3<uint32_t>(data.begin(), data.end()).value(), murmur3_32);
+
+  #if ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1)
+      constexpr uint32_t jenkins_32 = etl::hash_of<etl::jenkins>("123456789");
+
+      CHECK_EQUAL(etl::jenkins(data.begin(), data.end()).value(), jenkins_32);
+  #endif
+    }
+
+    //*************************************************************************
+    TEST(test_case_labels)
+    {
+      std::string topics[] = {"topic/a", "topic/b", "topic/c"};
+
+      int results[3] = {};
+
+      for (size_t i = 0UL; i < 3UL; ++i)
+      {
+        switch (etl::hash_of<etl::crc32_c>(topics[i].c_str(), topics[i].size()))
+        {
+          case etl::hash_of<etl::crc32_c>("topic/a"): results[i] = 1; break;
+          case etl::hash_of<etl::crc32_c>("topic/b"): results[i] = 2; break;
+          default: results[i] = 3; break;
+        }
+      }
+
+      CHECK_EQUAL(1, results[0]);
+      CHECK_EQUAL(2, results[1]);
+      CHECK_EQUAL(3, results[2]);
+    }
+#endif
+  }
+} // namespace
@@ -0,0 +1,343 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/atomic.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/intrusive_links.h"
+#include "etl/intrusive_queue.h"
+#include "etl/intrusive_queue_mpsc_atomic.h"
+#include "etl/message.h"
+#include "etl/reference_counted_message_pool.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+  #define REALTIME_TEST 0
+
+namespace
+{
+  typedef etl::forward_link<0> link_fwd;
+
+  struct Data : public link_fwd
+  {
+    Data(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  bool operator==(const Data& lhs, const Data& rhs)
+  {
+    return lhs.i == rhs.i;
+  }
+
+  std::ostream& operator<<(std::ostream& os, const Data& data)
+  {
+    os << data.i;
+    return os;
+  }
+
+  //*************************************************************************
+  // A message that can be linked in to an intrusive queue while it lives in a
+  // reference counted message pool.
+  struct Message1
+    : public etl::message<1>
+    , public link_fwd
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  typedef etl::intrusive_queue_mpsc_atomic<Data, link_fwd> Queue;
+
+  SUITE(test_intrusive_queue_mpsc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_front_pop)
+    {
+      Data data1(1);
+      Data data2(2);
+      Data data3(3);
+
+      Queue queue;
+
+      queue.push(data1);
+      CHECK(!queue.empty());
+      CHECK_EQUAL(data1, queue.front());
+
+      queue.push(data2);
+      CHECK_EQUAL(data1, queue.front());
+
+      queue.pop();
+      CHECK_FALSE(data1.link_fwd::is_linked());
+      CHECK_EQUAL(data2, queue.front());
+
+      // Pushed while the consumer has values waiting.
+      queue.push(data3);
+      CHECK_EQUAL(data2, queue.front());
+
+      queue.pop();
+      CHECK_FALSE(data2.link_fwd::is_linked());
+      CHECK_EQUAL(data3, queue.front());
+
+      queue.pop();
+      CHECK_FALSE(data3.link_fwd::is_linked());
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_fifo_order)
+    {
+      std::vector<Data> data;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(Data(i));
+      }
+
+      Queue queue;
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        queue.push(data[i]);
+      }
+
+      CHECK_EQUAL(0, queue.front().i);
+      queue.pop();
+
+      for (size_t i = 5U; i < 10U; ++i)
+      {
+        queue.push(data[i]);
+      }
+
+      for (int i = 1; i < 10; ++i)
+      {
+        CHECK(!queue.empty());
+        CHECK_EQUAL(i, queue.front().i);
+        queue.pop();
+      }
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_double_push)
+    {
+      Data data1(1);
+      Data data2(2);
+
+      Queue queue;
+
+      queue.push(data1);
+      queue.push(data2);
+      CHECK_TRUE(data1.link_fwd::is_linked());
+      CHECK_TRUE(data2.link_fwd::is_linked());
+
+      CHECK_THROW(queue.push(data1), etl::intrusive_queue_value_is_already_linked);
+      CHECK_THROW(queue.push(data2), etl::intrusive_queue_value_is_already_linked);
+
+      CHECK_EQUAL(data1, queue.front());
+      queue.pop();
+      CHECK_THROW(queue.push(data2), etl::intrusive_queue_value_is_already_linked);
+      CHECK_EQUAL(data2, queue.front());
+      queue.pop();
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Data data1(1);
+      Data data2(2);
+      Data data3(3);
+
+      Queue queue;
+
+      queue.push(data1);
+      queue.push(data2);
+      queue.push(data3);
+
+      queue.clear();
+
+      CHECK(queue.empty());
+      CHECK_FALSE(data1.link_fwd::is_linked());
+      CHECK_FALSE(data2.link_fwd::is_linked());
+      CHECK_FALSE(data3.link_fwd::is_linked());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_into)
+    {
+      Data data1(1);
+      Data data2(2);
+
+      Queue                                queue1;
+      etl::intrusive_queue<Data, link_fwd> queue2;
+
+      queue1.push(data1);
+      queue1.push(data2);
+
+      queue1.pop_into(queue2);
+      CHECK_EQUAL(data2, queue1.front());
+      CHECK_EQUAL(1U, queue2.size());
+      CHECK_EQUAL(data1, queue2.front());
+
+      queue1.pop_into(queue2);
+      CHECK(queue1.empty());
+      CHECK_EQUAL(2U, queue2.size());
+      CHECK_EQUAL(data2, queue2.back());
+    }
+
+    //*************************************************************************
+    TEST(test_empty_exceptions)
+    {
+      Queue queue;
+
+      CHECK_THROW(queue.front(), etl::intrusive_queue_empty);
+      CHECK_THROW(queue.pop(), etl::intrusive_queue_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_pooled_messages)
+    {
+      typedef etl::atomic_counted_message_pool::pool_message_parameters<Message1> pool_message_parameters;
+
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size, pool_message_parameters::max_alignment, 4U> memory_allocator;
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      etl::intrusive_queue_mpsc_atomic<Message1, link_fwd> queue;
+
+      etl::reference_counted_message<Message1, etl::atomic_int>* p_rcm1 = message_pool.allocate<Message1>(1);
+      etl::reference_counted_message<Message1, etl::atomic_int>* p_rcm2 = message_pool.allocate<Message1>(2);
+
+      // The messages are linked where they live in the pool, without copying.
+      queue.push(p_rcm1->get_message());
+      queue.push(p_rcm2->get_message());
+
+      CHECK_EQUAL(&p_rcm1->get_message(), &queue.front());
+      CHECK_EQUAL(1, queue.front().i);
+      queue.pop();
+
+      CHECK_EQUAL(&p_rcm2->get_message(), &queue.front());
+      CHECK_EQUAL(2, queue.front().i);
+      queue.pop();
+
+      CHECK(queue.empty());
+
+      message_pool.release(*p_rcm1);
+      message_pool.release(*p_rcm2);
+    }
+
+  #if REALTIME_TEST
+    //*************************************************************************
+    TEST(test_multiple_producers)
+    {
+      static const int N_Producers = 4;
+      static const int Length      = 10000;
+
+      std::vector<Data> data;
+
+      for (int i = 0; i < (N_Producers * Length); ++i)
+      {
+        data.push_back(Data(i));
+      }
+
+      Queue queue;
+
+      std::vector<std::thread> producers;
+
+      for (int p = 0; p < N_Producers; ++p)
+      {
+        producers.push_back(std::thread([&queue, &data, p]()
+                                        {
+                                          for (int i = 0; i < Length; ++i)
+                                          {
+                                            queue.push(data[size_t((p * Length) + i)]);
+                                          }
+                                        }));
+      }
+
+      std::vector<int> received;
+      std::vector<int> last(N_Producers, -1);
+
+      while (received.size() < data.size())
+      {
+        if (!queue.empty())
+        {
+          int value = queue.front().i;
+          queue.pop();
+
+          // Each producer's values are received in order.
+          CHECK(value > last[size_t(value / Length)]);
+          last[size_t(value / Length)] = value;
+
+          received.push_back(value);
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      for (size_t i = 0U; i < producers.size(); ++i)
+      {
+        producers[i].join();
+      }
+
+      std::sort(received.begin(), received.end());
+
+      for (size_t i = 0U; i < received.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), received[i]);
+      }
+    }
+  #endif
+  }
+} // namespace
+
+#endif
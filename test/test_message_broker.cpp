@@ -122,6 +122,34 @@ namespace
     }
   };
 
+  //***************************************************************************
+  // Indexed broker
+  //***************************************************************************
+  class IndexedBroker : public etl::message_broker_indexed<6>
+  {
+  public:
+
+    IndexedBroker()
+      : message_broker_indexed()
+    {
+    }
+
+    using message_broker_indexed::receive;
+
+    // Hook incoming messages and translate Message5 to Message4.
+    void receive(const etl::imessage& msg) override
+    {
+      if (msg.get_message_id() == Message5::ID)
+      {
+        message_broker_indexed::receive(Message4());
+      }
+      else
+      {
+        message_broker_indexed::receive(msg);
+      }
+    }
+  };
+
   //***************************************************************************
   // Router that handles messages 1, 2, 3, 4, 5.
   //***************************************************************************
@@ -497,6 +525,194 @@ namespace
       CHECK_EQUAL(1, router3.message_unknown_count);
     }
 
+    //*************************************************************************
+    TEST(test_message_broker_indexed_send_messages_to_subscribers)
+    {
+      IndexedBroker broker;
+      Router router1(1);
+      Router router2(2);
+      Router router3(3);
+
+      Subscription subscription1{router1, {Message1::ID, Message2::ID, Message3::ID, Message4::ID}};
+      Subscription subscription2{router2, {Message1::ID, Message2::ID}};
+      Subscription subscription3{router2, {Message1::ID, Message3::ID}};
+
+      CHECK_TRUE(broker.is_indexed());
+
+      broker.subscribe(subscription1);
+      broker.subscribe(subscription2);
+      broker.subscribe(subscription3); // Duplicate router. Replace the old subscription.
+      broker.subscribe(subscription1); // Do subscription1 again to see if it breaks.
+      CHECK_TRUE(broker.is_indexed());
+
+      broker.set_successor(router3);
+
+      broker.receive(Message1());
+      broker.receive(Message2());
+      broker.receive(Message3());
+      broker.receive(Message4());
+      broker.receive(Message5());
+      broker.receive(Message6());
+      broker.receive(UnknownMessage());
+      broker.receive(2, Message1());
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(1, router3.message1_count); // Not addressed to router3.
+
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(0, router2.message2_count);
+      CHECK_EQUAL(1, router3.message2_count);
+
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router2.message3_count);
+      CHECK_EQUAL(1, router3.message3_count);
+
+      CHECK_EQUAL(2, router1.message4_count);
+      CHECK_EQUAL(0, router2.message4_count);
+      CHECK_EQUAL(2, router3.message4_count);
+
+      // Message5 is translated to Message4 in 'broker'.
+      CHECK_EQUAL(0, router1.message5_count);
+      CHECK_EQUAL(0, router2.message5_count);
+      CHECK_EQUAL(0, router3.message5_count);
+
+      CHECK_EQUAL(0, router1.message6_count);
+      CHECK_EQUAL(0, router2.message6_count);
+      CHECK_EQUAL(1, router3.message6_count);
+
+      CHECK_EQUAL(0, router1.message_unknown_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(1, router3.message_unknown_count);
+
+      // Unsubscribing removes the router's entries.
+      router1.clear();
+      router2.clear();
+      broker.unsubscribe(router1);
+
+      broker.receive(Message1());
+      broker.receive(Message2());
+      CHECK_EQUAL(0, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(0, router1.message2_count);
+
+      broker.clear();
+      CHECK_TRUE(broker.empty());
+      CHECK_TRUE(broker.is_indexed());
+
+      broker.receive(Message1());
+      CHECK_EQUAL(1, router2.message1_count);
+    }
+
+    //*************************************************************************
+    TEST(test_message_broker_indexed_full_index)
+    {
+      IndexedBroker broker;
+      Router router1(1);
+      Router router2(2);
+
+      // Duplicate message ids only use one entry.
+      Subscription subscription1{router1, {Message1::ID, Message2::ID, Message3::ID, Message4::ID, Message1::ID}};
+      Subscription subscription2{router2, {Message1::ID, Message2::ID}};
+      Subscription subscription3{router2, {Message1::ID, Message2::ID, Message3::ID}};
+
+      broker.subscribe(subscription1);
+      broker.subscribe(subscription2);
+      CHECK_TRUE(broker.is_indexed());
+
+      broker.receive(Message1());
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+
+      // Too many message ids for the index, so the subscriptions are scanned.
+      broker.subscribe(subscription3);
+      CHECK_FALSE(broker.is_indexed());
+
+      broker.receive(Message1());
+      broker.receive(Message3());
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router2.message3_count);
+      CHECK_TRUE(broker.accepts(MESSAGE3));
+      CHECK_FALSE(broker.accepts(MESSAGE6));
+
+      // Back within the size of the index.
+      broker.unsubscribe(router1);
+      CHECK_TRUE(broker.is_indexed());
+
+      broker.receive(Message3());
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(2, router2.message3_count);
+    }
+
+    //*************************************************************************
+    TEST(test_message_broker_indexed_through_base_reference)
+    {
+      IndexedBroker        indexed_broker;
+      etl::message_broker& broker = indexed_broker;
+      Router               router1(1);
+      Router               router2(2);
+
+      Subscription subscription1{router1, {Message1::ID, Message2::ID}};
+      Subscription subscription2{router2, {Message2::ID, Message3::ID}};
+
+      broker.subscribe(subscription1);
+      broker.subscribe(subscription2);
+      CHECK_TRUE(indexed_broker.accepts(MESSAGE3));
+
+      indexed_broker.receive(Message2());
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(1, router2.message2_count);
+
+      broker.unsubscribe(router1);
+      CHECK_FALSE(indexed_broker.accepts(MESSAGE1));
+
+      indexed_broker.receive(Message2());
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(2, router2.message2_count);
+
+      broker.clear();
+      CHECK_FALSE(indexed_broker.accepts(MESSAGE2));
+
+      indexed_broker.receive(Message2());
+      CHECK_EQUAL(2, router2.message2_count);
+    }
+
+    //*************************************************************************
+    TEST(test_message_broker_indexed_accepts)
+    {
+      Router router1(1);
+      Router router2(2);
+      Router router3(3);
+
+      Subscription subscription1{router1, {Message1::ID, Message3::ID}};
+      Subscription subscription2{router2, {Message1::ID, Message2::ID, Message3::ID, Message4::ID}};
+
+      IndexedBroker broker;
+
+      CHECK_FALSE(broker.accepts(MESSAGE1));
+      CHECK_FALSE(broker.accepts(MESSAGE2));
+
+      broker.subscribe(subscription1);
+      CHECK_TRUE(broker.accepts(MESSAGE1));
+      CHECK_FALSE(broker.accepts(MESSAGE2));
+      CHECK_TRUE(broker.accepts(MESSAGE3));
+      CHECK_FALSE(broker.accepts(MESSAGE4));
+
+      broker.subscribe(subscription2);
+      CHECK_TRUE(broker.accepts(MESSAGE1));
+      CHECK_TRUE(broker.accepts(MESSAGE2));
+      CHECK_TRUE(broker.accepts(MESSAGE3));
+      CHECK_TRUE(broker.accepts(MESSAGE4));
+      CHECK_FALSE(broker.accepts(MESSAGE5));
+      CHECK_FALSE(broker.accepts(MESSAGE6));
+
+      broker.set_successor(router3);
+      CHECK_TRUE(broker.accepts(MESSAGE5));
+      CHECK_TRUE(broker.accepts(MESSAGE6));
+    }
+
     //*************************************************************************
     TEST(test_message_broker_accepts)
     {
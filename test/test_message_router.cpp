@@ -270,6 +270,71 @@ namespace
     int sender_id;
   };
 
+  //***************************************************************************
+  // Messages with sparse ids.
+  //***************************************************************************
+  struct SparseMessage10 : public etl::message<10>
+  {
+  };
+
+  struct SparseMessage60 : public etl::message<60>
+  {
+  };
+
+  struct SparseMessage61 : public etl::message<61>
+  {
+  };
+
+  struct SparseMessage200 : public etl::message<200>
+  {
+  };
+
+  struct SparseMessage250 : public etl::message<250>
+  {
+  };
+
+  //***************************************************************************
+  // Router that handles messages with sparse ids 10, 60 and 200.
+  //***************************************************************************
+  class SparseRouter : public etl::message_router<SparseRouter, SparseMessage200, SparseMessage10, SparseMessage60>
+  {
+  public:
+
+    SparseRouter()
+      : message_router(ROUTER3)
+      , message10_count(0)
+      , message60_count(0)
+      , message200_count(0)
+      , message_unknown_count(0)
+    {
+    }
+
+    void on_receive(const SparseMessage10&)
+    {
+      ++message10_count;
+    }
+
+    void on_receive(const SparseMessage60&)
+    {
+      ++message60_count;
+    }
+
+    void on_receive(const SparseMessage200&)
+    {
+      ++message200_count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    int message10_count;
+    int message60_count;
+    int message200_count;
+    int message_unknown_count;
+  };
+
   //***************************************************************************
   // Router that handles messages 1, 2, 3.
   // 'receive' is overridden.
@@ -799,6 +864,63 @@ namespace
       CHECK_EQUAL(0, r1.message_unknown_count);
     }
 
+    //*************************************************************************
+    TEST(message_router_with_sparse_message_ids)
+    {
+      SparseRouter router;
+
+      SparseMessage10  message10;
+      SparseMessage60  message60;
+      SparseMessage61  message61;
+      SparseMessage200 message200;
+      SparseMessage250 message250;
+      Message1         message1(router);
+
+      router.receive(message200);
+      router.receive(message10);
+      router.receive(message60);
+      router.receive(message60);
+      CHECK_EQUAL(1, router.message10_count);
+      CHECK_EQUAL(2, router.message60_count);
+      CHECK_EQUAL(1, router.message200_count);
+      CHECK_EQUAL(0, router.message_unknown_count);
+
+      // Below, between and above the handled ids.
+      router.receive(message1);
+      router.receive(message61);
+      router.receive(message250);
+      CHECK_EQUAL(3, router.message_unknown_count);
+
+      CHECK(router.accepts(message10));
+      CHECK(router.accepts(message60));
+      CHECK(router.accepts(message200));
+      CHECK(!router.accepts(message1));
+      CHECK(!router.accepts(message61));
+      CHECK(!router.accepts(message250));
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(message_router_perfect_hash)
+    {
+      static constexpr etl::array<etl::message_id_t, 7> ids = {{3, 17, 42, 99, 128, 201, 255}};
+      static constexpr etl::private_message_router::perfect_hash<7> hash = etl::private_message_router::make_perfect_hash(ids);
+
+      CHECK(hash.valid);
+
+      for (size_t i = 0U; i < ids.size(); ++i)
+      {
+        CHECK_EQUAL(i, hash.find(ids[i]));
+      }
+
+      // Any id finds an empty slot or one of the ids.
+      for (size_t id = 0U; id < 256U; ++id)
+      {
+        CHECK(hash.find(static_cast<etl::message_id_t>(id)) <= ids.size());
+      }
+    }
+#endif
+
     //*************************************************************************
     TEST(message_router_with_overloaded_receive)
     {
@@ -0,0 +1,247 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+// 16 bit message ids with a small dense range, so that a router with widely
+// spread ids finds its handlers with a perfect hash. These change the message
+// id type, so these tests are built as their own executable,
+// etl_message_router_perfect_hash_tests.
+#if !defined(ETL_MESSAGE_ID_TYPE)
+  #define ETL_MESSAGE_ID_TYPE uint16_t
+#endif
+
+#if !defined(ETL_MESSAGE_ROUTER_MAX_DENSE_ID_RANGE)
+  #define ETL_MESSAGE_ROUTER_MAX_DENSE_ID_RANGE 16
+#endif
+
+#include "unit_test_framework.h"
+
+#include "etl/array.h"
+#include "etl/message_router.h"
+
+#if ETL_USING_CPP14 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+
+namespace
+{
+  enum
+  {
+    MESSAGE1 = 3,
+    MESSAGE2 = 100,
+    MESSAGE3 = 1000,
+    MESSAGE4 = 20000,
+    MESSAGE5 = 65000
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+  };
+
+  struct Message3 : public etl::message<MESSAGE3>
+  {
+  };
+
+  struct Message4 : public etl::message<MESSAGE4>
+  {
+  };
+
+  struct Message5 : public etl::message<MESSAGE5>
+  {
+  };
+
+  // Ids that the router does not handle, below, within and above its range.
+  struct Unknown_Below : public etl::message<1>
+  {
+  };
+
+  struct Unknown_Within : public etl::message<500>
+  {
+  };
+
+  struct Unknown_Above : public etl::message<65535>
+  {
+  };
+
+  //***************************************************************************
+  // The message types are listed out of id order.
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message4, Message1, Message5, Message3, Message2>
+  {
+  public:
+
+    Router()
+      : message_router(1)
+      , counts()
+      , unknown_count(0)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      ++counts[0];
+    }
+
+    void on_receive(const Message2&)
+    {
+      ++counts[1];
+    }
+
+    void on_receive(const Message3&)
+    {
+      ++counts[2];
+    }
+
+    void on_receive(const Message4&)
+    {
+      ++counts[3];
+    }
+
+    void on_receive(const Message5&)
+    {
+      ++counts[4];
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++unknown_count;
+    }
+
+    int counts[5];
+    int unknown_count;
+  };
+
+  //***************************************************************************
+  // 120 distinct ids spread over the 16 bit range.
+  //***************************************************************************
+  constexpr size_t Many_Ids = 120U;
+
+  constexpr etl::array<etl::message_id_t, Many_Ids> make_many_ids()
+  {
+    etl::array<etl::message_id_t, Many_Ids> ids{};
+
+    for (size_t i = 0U; i < Many_Ids; ++i)
+    {
+      ids[i] = static_cast<etl::message_id_t>((i * 541U) + 7U);
+    }
+
+    return ids;
+  }
+
+  constexpr etl::array<etl::message_id_t, Many_Ids> many_ids = make_many_ids();
+
+  static_assert(etl::private_message_router::make_perfect_hash(many_ids).valid, "No perfect hash for 120 ids");
+
+  SUITE(test_message_router_perfect_hash)
+  {
+    //*************************************************************************
+    TEST(test_message_id_type)
+    {
+      CHECK_EQUAL(2U, sizeof(etl::message_id_t));
+    }
+
+    //*************************************************************************
+    TEST(test_known_ids)
+    {
+      Router router;
+
+      router.receive(Message1());
+      router.receive(Message2());
+      router.receive(Message2());
+      router.receive(Message3());
+      router.receive(Message4());
+      router.receive(Message5());
+
+      CHECK_EQUAL(1, router.counts[0]);
+      CHECK_EQUAL(2, router.counts[1]);
+      CHECK_EQUAL(1, router.counts[2]);
+      CHECK_EQUAL(1, router.counts[3]);
+      CHECK_EQUAL(1, router.counts[4]);
+      CHECK_EQUAL(0, router.unknown_count);
+
+      CHECK_TRUE(router.accepts(MESSAGE1));
+      CHECK_TRUE(router.accepts(MESSAGE5));
+    }
+
+    //*************************************************************************
+    TEST(test_unknown_ids)
+    {
+      Router router;
+
+      router.receive(Unknown_Within());
+      CHECK_EQUAL(1, router.unknown_count);
+
+      // Every id in the range that is not handled.
+      for (uint32_t id = MESSAGE1; id <= MESSAGE5; ++id)
+      {
+        const etl::message_id_t message_id = static_cast<etl::message_id_t>(id);
+
+        if ((message_id != MESSAGE1) && (message_id != MESSAGE2) && (message_id != MESSAGE3) && (message_id != MESSAGE4) && (message_id != MESSAGE5))
+        {
+          CHECK_FALSE(router.accepts(message_id));
+        }
+      }
+
+      for (int count : router.counts)
+      {
+        CHECK_EQUAL(0, count);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_out_of_range_ids)
+    {
+      Router router;
+
+      router.receive(Unknown_Below());
+      router.receive(Unknown_Above());
+
+      CHECK_EQUAL(2, router.unknown_count);
+      CHECK_FALSE(router.accepts(1));
+      CHECK_FALSE(router.accepts(65535));
+
+      for (int count : router.counts)
+      {
+        CHECK_EQUAL(0, count);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_perfect_hash_finds_every_id)
+    {
+      constexpr etl::private_message_router::perfect_hash<Many_Ids> hash = etl::private_message_router::make_perfect_hash(many_ids);
+
+      for (size_t i = 0U; i < Many_Ids; ++i)
+      {
+        CHECK_EQUAL(i, hash.find(many_ids[i]));
+      }
+    }
+  }
+} // namespace
+
+#endif
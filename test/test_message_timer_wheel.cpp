@@ -0,0 +1,570 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/message_bus.h"
+#include "etl/message_router.h"
+#include "etl/message_timer.h"
+#include "etl/message_timer_wheel.h"
+
+#include <utility>
+#include <vector>
+
+namespace
+{
+  uint64_t ticks = 0ULL;
+
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2,
+    MESSAGE3,
+    TIMER_MESSAGE
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    ROUTER2 = 2
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+  };
+
+  struct Message3 : public etl::message<MESSAGE3>
+  {
+  };
+
+  //***************************************************************************
+  // A message that says which timer sent it.
+  //***************************************************************************
+  struct TimerMessage : public etl::message<TIMER_MESSAGE>
+  {
+    size_t index;
+  };
+
+  Message1 message1;
+  Message2 message2;
+  Message3 message3;
+
+  //***************************************************************************
+  // Router that records the time that each message is received.
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2, Message3, TimerMessage>
+  {
+  public:
+
+    Router(etl::message_router_id_t id_)
+      : message_router(id_)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      message1.push_back(ticks);
+    }
+
+    void on_receive(const Message2&)
+    {
+      message2.push_back(ticks);
+    }
+
+    void on_receive(const Message3&)
+    {
+      message3.push_back(ticks);
+    }
+
+    void on_receive(const TimerMessage& msg)
+    {
+      events.push_back(std::make_pair(ticks, msg.index));
+    }
+
+    void on_receive_unknown(const etl::imessage&) {}
+
+    void clear()
+    {
+      message1.clear();
+      message2.clear();
+      message3.clear();
+      events.clear();
+    }
+
+    std::vector<uint64_t>                     message1;
+    std::vector<uint64_t>                     message2;
+    std::vector<uint64_t>                     message3;
+    std::vector<std::pair<uint64_t, size_t> > events;
+  };
+
+  //***************************************************************************
+  // Bus that routes the messages.
+  //***************************************************************************
+  class Bus : public etl::message_bus<2>
+  {
+  };
+
+  Router router1(ROUTER1);
+  Router router2(ROUTER2);
+
+  //***************************************************************************
+  template <typename TController>
+  void run(TController& controller, uint64_t end, uint32_t step)
+  {
+    while (ticks < end)
+    {
+      ticks += step;
+      controller.tick(step);
+    }
+  }
+
+  SUITE(test_message_timer_wheel)
+  {
+    //*************************************************************************
+    TEST(message_timer_wheel_too_many_timers)
+    {
+      etl::message_timer_wheel<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::Single_Shot);
+
+      CHECK(id1 != etl::timer::id::NO_TIMER);
+      CHECK(id2 != etl::timer::id::NO_TIMER);
+      CHECK(id3 == etl::timer::id::NO_TIMER);
+
+      timer_controller.clear();
+      id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::Single_Shot);
+      CHECK(id3 != etl::timer::id::NO_TIMER);
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_null_router)
+    {
+      etl::message_timer_wheel<2> timer_controller;
+      etl::null_message_router    null_router;
+
+      etl::timer::id::type id = timer_controller.register_timer(message1, null_router, 37, etl::timer::mode::Single_Shot);
+
+      CHECK(id == etl::timer::id::NO_TIMER);
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_one_shot)
+    {
+      etl::message_timer_wheel<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::Single_Shot);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 100U, 1U);
+
+      std::vector<uint64_t> compare1 = {37};
+      std::vector<uint64_t> compare2 = {23};
+      std::vector<uint64_t> compare3 = {11};
+
+      CHECK(router1.message1 == compare1);
+      CHECK(router1.message2 == compare2);
+      CHECK(router1.message3 == compare3);
+      CHECK(!timer_controller.has_active_timer());
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_repeating)
+    {
+      etl::message_timer_wheel<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::Repeating);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 100U, 1U);
+
+      std::vector<uint64_t> compare1 = {37, 74};
+      std::vector<uint64_t> compare2 = {23, 46, 69, 92};
+      std::vector<uint64_t> compare3 = {11, 22, 33, 44, 55, 66, 77, 88, 99};
+
+      CHECK(router1.message1 == compare1);
+      CHECK(router1.message2 == compare2);
+      CHECK(router1.message3 == compare3);
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_repeating_bigger_step)
+    {
+      etl::message_timer_wheel<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(message3, router1, 11, etl::timer::mode::Repeating);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 100U, 5U);
+
+      // The messages are received in the tick that they are due in.
+      std::vector<uint64_t> compare1 = {40, 75};
+      std::vector<uint64_t> compare2 = {25, 50, 70, 95};
+      std::vector<uint64_t> compare3 = {15, 25, 35, 45, 55, 70, 80, 90, 100};
+
+      CHECK(router1.message1 == compare1);
+      CHECK(router1.message2 == compare2);
+      CHECK(router1.message3 == compare3);
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_repeating_stop_start)
+    {
+      etl::message_timer_wheel<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::Repeating);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      while (ticks < 100U)
+      {
+        if (ticks == 40U)
+        {
+          timer_controller.stop(id2);
+          CHECK(!timer_controller.is_active(id2));
+        }
+
+        if (ticks == 80U)
+        {
+          timer_controller.start(id2);
+          CHECK(timer_controller.is_active(id2));
+        }
+
+        ++ticks;
+        timer_controller.tick(1U);
+      }
+
+      std::vector<uint64_t> compare1 = {37, 74};
+      std::vector<uint64_t> compare2 = {23};
+
+      CHECK(router1.message1 == compare1);
+      CHECK(router1.message2 == compare2);
+      CHECK(timer_controller.is_active(id1));
+      CHECK(timer_controller.is_active(id2));
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_register_unregister)
+    {
+      etl::message_timer_wheel<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::Repeating);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 50U, 1U);
+
+      CHECK(timer_controller.unregister_timer(id1));
+      CHECK(!timer_controller.unregister_timer(id1));
+      CHECK(!timer_controller.start(id1));
+      CHECK(!timer_controller.stop(id1));
+      CHECK(!timer_controller.has_active_timer());
+
+      run(timer_controller, 100U, 1U);
+
+      std::vector<uint64_t> compare1 = {37};
+
+      CHECK(router1.message1 == compare1);
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_delayed_immediate)
+    {
+      etl::message_timer_wheel<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::Repeating);
+
+      router1.clear();
+
+      timer_controller.start(id1, etl::timer::start::Immediate);
+      timer_controller.start(id2, etl::timer::start::Delayed);
+      timer_controller.enable(true);
+
+      ticks = 0;
+      timer_controller.tick(0U);
+      run(timer_controller, 80U, 1U);
+
+      std::vector<uint64_t> compare1 = {0, 37, 74};
+      std::vector<uint64_t> compare2 = {23, 46, 69};
+
+      CHECK(router1.message1 == compare1);
+      CHECK(router1.message2 == compare2);
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_destination_router)
+    {
+      Bus bus;
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      etl::message_timer_wheel<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, bus, 10, etl::timer::mode::Single_Shot, ROUTER2);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, bus, 20, etl::timer::mode::Single_Shot);
+
+      router1.clear();
+      router2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 30U, 1U);
+
+      CHECK(router1.message1.empty());
+      CHECK_EQUAL(1U, router2.message1.size());
+      CHECK_EQUAL(1U, router1.message2.size());
+      CHECK_EQUAL(1U, router2.message2.size());
+
+      bus.clear();
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_time_to_next)
+    {
+      etl::message_timer_wheel<2> timer_controller;
+
+      CHECK_EQUAL(static_cast<uint32_t>(etl::timer::interval::No_Active_Interval), timer_controller.time_to_next());
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 5000, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, 300, etl::timer::mode::Single_Shot);
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.enable(true);
+
+      CHECK_EQUAL(300U, timer_controller.time_to_next());
+
+      timer_controller.tick(299U);
+      CHECK_EQUAL(1U, timer_controller.time_to_next());
+
+      timer_controller.tick(1U);
+      CHECK_EQUAL(4700U, timer_controller.time_to_next());
+
+      timer_controller.tick(4700U);
+      CHECK_EQUAL(5000U, timer_controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_long_periods)
+    {
+      etl::message_timer_wheel<2> timer_controller;
+
+      const uint32_t period1 = 0xFFFFFFFEUL;
+      const uint32_t period2 = 1000000UL;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, period1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, period2, etl::timer::mode::Repeating);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, uint64_t(period1) + 10U, 0x10000U);
+
+      CHECK_EQUAL(1U, router1.message1.size());
+      CHECK(router1.message1[0] >= period1);
+      CHECK(router1.message1[0] < uint64_t(period1) + 0x10000U);
+      CHECK_EQUAL(size_t(ticks / period2), router1.message2.size());
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_matches_message_timer)
+    {
+      const size_t Timers = 200U;
+
+      Router list_router(ROUTER1);
+      Router wheel_router(ROUTER2);
+
+      std::vector<TimerMessage> messages(Timers);
+
+      etl::message_timer<Timers>       list_controller;
+      etl::message_timer_wheel<Timers> wheel_controller;
+
+      uint32_t random = 12345U;
+
+      for (size_t i = 0U; i < Timers; ++i)
+      {
+        random = (random * 1103515245U) + 12345U;
+
+        // Periods from a few ticks to beyond the second level of the wheel.
+        const uint32_t period    = (random >> 8) % ((i % 4U == 0U) ? 300000U : 5000U);
+        const bool     repeating = (i % 3U) != 0U;
+
+        messages[i].index = i;
+
+        list_controller.register_timer(messages[i], list_router, period + 1U, repeating);
+        wheel_controller.register_timer(messages[i], wheel_router, period + 1U, repeating);
+      }
+
+      list_controller.enable(true);
+      wheel_controller.enable(true);
+
+      ticks = 0U;
+
+      for (size_t step = 0U; step < 20000U; ++step)
+      {
+        random = (random * 1103515245U) + 12345U;
+
+        const etl::timer::id::type id = static_cast<etl::timer::id::type>((random >> 8) % Timers);
+
+        switch ((random >> 4) % 8U)
+        {
+          case 0:
+          {
+            list_controller.stop(id);
+            wheel_controller.stop(id);
+            break;
+          }
+
+          case 1:
+          case 2:
+          {
+            list_controller.start(id);
+            wheel_controller.start(id);
+            break;
+          }
+
+          default:
+          {
+            break;
+          }
+        }
+
+        // Mostly small steps, with the occasional large one.
+        const uint32_t count = ((random >> 12) % 16U == 0U) ? (random >> 12) % 20000U : (random >> 12) % 50U;
+
+        ticks += count;
+        list_controller.tick(count);
+        wheel_controller.tick(count);
+
+        CHECK_EQUAL(list_controller.time_to_next(), wheel_controller.time_to_next());
+      }
+
+      CHECK(!list_router.events.empty());
+      CHECK_EQUAL(list_router.events.size(), wheel_router.events.size());
+      CHECK(list_router.events == wheel_router.events);
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_two_thousand_timers)
+    {
+      const size_t Timers = 2000U;
+
+      typedef etl::message_timer_wheel<Timers> Controller;
+
+      CHECK((etl::is_same<uint_least16_t, Controller::id_type>::value));
+
+      std::vector<TimerMessage> messages(Timers);
+
+      Controller timer_controller;
+
+      router1.clear();
+
+      for (size_t i = 0U; i < Timers; ++i)
+      {
+        messages[i].index = i;
+
+        Controller::id_type id = timer_controller.register_timer(messages[i], router1, uint32_t(i + 1U), etl::timer::mode::Single_Shot);
+
+        CHECK_EQUAL(i, id);
+        timer_controller.start(id);
+      }
+
+      CHECK_EQUAL(Controller::NO_TIMER, timer_controller.register_timer(message1, router1, 1U, etl::timer::mode::Single_Shot));
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, Timers, 1U);
+
+      CHECK_EQUAL(Timers, router1.events.size());
+
+      for (size_t i = 0U; i < router1.events.size(); ++i)
+      {
+        CHECK_EQUAL(i + 1U, router1.events[i].first);
+        CHECK_EQUAL(i, router1.events[i].second);
+      }
+
+      CHECK(!timer_controller.has_active_timer());
+    }
+  }
+} // namespace
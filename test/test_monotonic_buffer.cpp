@@ -0,0 +1,230 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/monotonic_buffer.h"
+#include "etl/string.h"
+#include "etl/vector.h"
+
+namespace
+{
+  const size_t Buffer_Size = 256U;
+
+  alignas(uint64_t) char buffer[Buffer_Size];
+
+  bool is_aligned(const void* p, size_t alignment)
+  {
+    return (reinterpret_cast<uintptr_t>(p) % alignment) == 0U;
+  }
+
+  SUITE(test_monotonic_buffer)
+  {
+    //*************************************************************************
+    TEST(test_construct)
+    {
+      etl::monotonic_buffer arena(buffer, Buffer_Size);
+
+      CHECK(arena.empty());
+      CHECK_EQUAL(0U, arena.size());
+      CHECK_EQUAL(Buffer_Size, arena.capacity());
+      CHECK_EQUAL(Buffer_Size, arena.available());
+      CHECK_EQUAL(0U, arena.max_usage());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_aligned)
+    {
+      etl::monotonic_buffer arena(buffer, Buffer_Size);
+
+      void* p1 = arena.allocate(1, 1);
+      void* p2 = arena.allocate(sizeof(uint32_t), alignof(uint32_t));
+      void* p3 = arena.allocate(1, 1);
+      void* p4 = arena.allocate(sizeof(uint64_t), alignof(uint64_t));
+
+      CHECK(p1 == buffer);
+      CHECK(p2 == buffer + 4);
+      CHECK(p3 == buffer + 8);
+      CHECK(p4 == buffer + 16);
+      CHECK(is_aligned(p4, alignof(uint64_t)));
+
+      CHECK_EQUAL(24U, arena.size());
+      CHECK_EQUAL(Buffer_Size - 24U, arena.available());
+      CHECK(arena.is_owner_of(p1));
+      CHECK(arena.is_owner_of(p4));
+      CHECK(!arena.is_owner_of(&arena));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_until_full)
+    {
+      etl::monotonic_buffer arena(buffer, Buffer_Size);
+
+      CHECK(arena.allocate(Buffer_Size - 8U, 1) != nullptr);
+      CHECK(arena.allocate(16, 1) == nullptr);
+      CHECK(arena.allocate(8, 1) != nullptr);
+      CHECK(arena.allocate(1, 1) == nullptr);
+      CHECK_EQUAL(0U, arena.available());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_storage)
+    {
+      etl::monotonic_buffer arena(buffer, Buffer_Size);
+
+      arena.allocate(1, 1);
+
+      uint32_t* p = arena.allocate_storage<uint32_t>(4);
+
+      CHECK(p != nullptr);
+      CHECK(is_aligned(p, alignof(uint32_t)));
+      CHECK_EQUAL(20U, arena.size());
+
+      CHECK(arena.allocate_storage<uint32_t>(Buffer_Size) == nullptr);
+      CHECK(arena.allocate_storage<uint32_t>(size_t(-1)) == nullptr);
+      CHECK_EQUAL(20U, arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_mark_rewind)
+    {
+      etl::monotonic_buffer arena(buffer, Buffer_Size);
+
+      arena.allocate(10, 1);
+      etl::monotonic_buffer::mark_type mark1 = arena.mark();
+
+      arena.allocate(20, 1);
+      etl::monotonic_buffer::mark_type mark2 = arena.mark();
+
+      arena.allocate(30, 1);
+      CHECK_EQUAL(60U, arena.size());
+
+      arena.rewind(mark2);
+      CHECK_EQUAL(30U, arena.size());
+
+      arena.rewind(mark1);
+      CHECK_EQUAL(10U, arena.size());
+
+      CHECK_THROW(arena.rewind(mark2), etl::monotonic_buffer_invalid_mark);
+      CHECK_EQUAL(10U, arena.size());
+
+      CHECK_EQUAL(60U, arena.max_usage());
+
+      arena.reset();
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_nested_scopes)
+    {
+      etl::monotonic_buffer arena(buffer, Buffer_Size);
+
+      {
+        etl::monotonic_buffer::scope outer(arena);
+        arena.allocate(10, 1);
+
+        {
+          etl::monotonic_buffer::scope inner(arena);
+          arena.allocate(20, 1);
+          CHECK_EQUAL(30U, arena.size());
+        }
+
+        CHECK_EQUAL(10U, arena.size());
+      }
+
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_release_most_recent)
+    {
+      etl::monotonic_buffer arena(buffer, Buffer_Size);
+
+      void* p1 = arena.allocate(10, 1);
+      void* p2 = arena.allocate(20, 1);
+
+      // Not the most recent, so only freed by a rewind.
+      CHECK(arena.release(p1));
+      CHECK_EQUAL(30U, arena.size());
+
+      CHECK(arena.release(p2));
+      CHECK_EQUAL(10U, arena.size());
+
+      // Already released.
+      CHECK(arena.release(p2));
+      CHECK_EQUAL(10U, arena.size());
+
+      CHECK(!arena.release(&arena));
+    }
+
+    //*************************************************************************
+    TEST(test_successor)
+    {
+      etl::monotonic_buffer                                    arena(buffer, Buffer_Size);
+      etl::fixed_sized_memory_block_allocator<512, alignof(uint32_t), 1> large;
+
+      arena.set_successor(large);
+
+      void* p = arena.allocate(500, alignof(uint32_t));
+
+      CHECK(p != nullptr);
+      CHECK(large.is_owner_of(p));
+      CHECK(arena.release(p));
+    }
+
+    //*************************************************************************
+    TEST(test_ext_containers)
+    {
+      etl::monotonic_buffer arena(buffer, Buffer_Size);
+
+      {
+        etl::monotonic_buffer::scope request(arena);
+
+        const size_t Vector_Size = 8U;
+        const size_t String_Size = 16U;
+
+        etl::vector_ext<int> data(arena.allocate_storage<int>(Vector_Size), Vector_Size);
+        etl::string_ext      text(arena.allocate_storage<char>(String_Size + 1U), String_Size + 1U);
+
+        data.push_back(1);
+        data.push_back(2);
+        text.assign("Hello");
+
+        CHECK_EQUAL(2U, data.size());
+        CHECK_EQUAL(Vector_Size, data.max_size());
+        CHECK(text == "Hello");
+        CHECK_EQUAL(String_Size, text.max_size());
+        CHECK(arena.is_owner_of(data.data()));
+        CHECK(arena.is_owner_of(text.data()));
+      }
+
+      CHECK(arena.empty());
+    }
+  }
+} // namespace
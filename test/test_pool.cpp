@@ -393,6 +393,25 @@ namespace
       CHECK(!pool.is_in_pool(&not_in_pool));
     }
 
+    //*************************************************************************
+    TEST(test_is_allocated)
+    {
+      etl::pool<Test_Data, 4> pool;
+      Test_Data               not_in_pool;
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+
+      CHECK(pool.is_allocated(p1));
+      CHECK(pool.is_allocated(p2));
+      CHECK(!pool.is_allocated(&not_in_pool));
+
+      pool.release(p1);
+
+      CHECK(!pool.is_allocated(p1));
+      CHECK(pool.is_allocated(p2));
+    }
+
     //*************************************************************************
     TEST(test_type_error)
     {
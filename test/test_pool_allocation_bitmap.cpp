@@ -0,0 +1,179 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// The allocation bitmap changes the layout of etl::ipool, so these tests are
+// built as their own executable, etl_pool_allocation_bitmap_tests.
+#if !defined(ETL_POOL_ALLOCATION_BITMAP)
+  #define ETL_POOL_ALLOCATION_BITMAP
+#endif
+
+#include "unit_test_framework.h"
+
+#include "etl/pool.h"
+
+#if defined(ETL_POOL_ALLOCATION_BITMAP)
+
+#include <set>
+
+namespace
+{
+  const size_t Pool_Size = 70U;
+
+  typedef etl::pool<uint32_t, Pool_Size> Pool;
+
+  SUITE(test_pool_allocation_bitmap)
+  {
+    //*************************************************************************
+    TEST(test_is_allocated)
+    {
+      Pool     pool;
+      uint32_t not_in_pool;
+
+      uint32_t* p1 = pool.allocate();
+      uint32_t* p2 = pool.allocate();
+
+      CHECK(pool.is_allocated(p1));
+      CHECK(pool.is_allocated(p2));
+      CHECK(!pool.is_allocated(&not_in_pool));
+
+      pool.release(p1);
+
+      CHECK(!pool.is_allocated(p1));
+      CHECK(pool.is_allocated(p2));
+
+      // Not yet handed out.
+      CHECK(!pool.is_allocated(p2 + 1));
+    }
+
+    //*************************************************************************
+    TEST(test_release_not_allocated)
+    {
+      Pool pool;
+
+      uint32_t* p1 = pool.allocate();
+      uint32_t* p2 = pool.allocate();
+
+      pool.release(p1);
+
+      // Released twice.
+      CHECK_THROW(pool.release(p1), etl::pool_object_not_in_pool);
+      CHECK_EQUAL(1U, pool.size());
+
+      // Never allocated.
+      CHECK_THROW(pool.release(p2 + 1), etl::pool_object_not_in_pool);
+      CHECK_EQUAL(1U, pool.size());
+
+      pool.release(p2);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_iterate_sparse)
+    {
+      Pool      pool;
+      uint32_t* items[Pool_Size];
+
+      for (size_t i = 0U; i < Pool_Size; ++i)
+      {
+        items[i]  = pool.allocate();
+        *items[i] = uint32_t(i);
+      }
+
+      // Leave every third item allocated, crossing the bitmap word boundaries.
+      std::set<uint32_t> expected;
+
+      for (size_t i = 0U; i < Pool_Size; ++i)
+      {
+        if ((i % 3U) == 0U)
+        {
+          expected.insert(uint32_t(i));
+        }
+        else
+        {
+          pool.release(items[i]);
+        }
+      }
+
+      std::set<uint32_t> actual;
+
+      for (Pool::iterator itr = pool.begin(); itr != pool.end(); ++itr)
+      {
+        actual.insert(*reinterpret_cast<uint32_t*>(*itr));
+      }
+
+      CHECK(expected == actual);
+      CHECK_EQUAL(expected.size(), size_t(std::distance(pool.begin(), pool.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_iterate_last_item_only)
+    {
+      Pool      pool;
+      uint32_t* items[Pool_Size];
+
+      for (size_t i = 0U; i < Pool_Size; ++i)
+      {
+        items[i] = pool.allocate();
+      }
+
+      for (size_t i = 0U; i < (Pool_Size - 1U); ++i)
+      {
+        pool.release(items[i]);
+      }
+
+      Pool::const_iterator itr = pool.cbegin();
+
+      CHECK(itr != pool.cend());
+      CHECK(reinterpret_cast<const uint32_t*>(*itr) == items[Pool_Size - 1U]);
+      ++itr;
+      CHECK(itr == pool.cend());
+    }
+
+    //*************************************************************************
+    TEST(test_release_all)
+    {
+      Pool pool;
+
+      uint32_t* p1 = pool.allocate();
+      pool.allocate();
+
+      pool.release_all();
+
+      CHECK(!pool.is_allocated(p1));
+      CHECK(pool.begin() == pool.end());
+
+      uint32_t* p2 = pool.allocate();
+
+      CHECK(p1 == p2);
+      CHECK(pool.is_allocated(p2));
+      CHECK_EQUAL(1, std::distance(pool.begin(), pool.end()));
+    }
+  }
+} // namespace
+
+#endif
@@ -0,0 +1,306 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "data.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/pool_atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+typedef TestDataDC<std::string> Test_Data;
+
+namespace
+{
+  struct D2
+  {
+    D2(const std::string& a_, const std::string& b_)
+      : a(a_)
+      , b(b_)
+    {
+    }
+
+    std::string a;
+    std::string b;
+  };
+
+  SUITE(test_pool_atomic)
+  {
+    //*************************************************************************
+    TEST(test_allocate)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      Test_Data* p1 = nullptr;
+      Test_Data* p2 = nullptr;
+      Test_Data* p3 = nullptr;
+      Test_Data* p4 = nullptr;
+
+      CHECK_NO_THROW(p1 = pool.allocate());
+      CHECK_NO_THROW(p2 = pool.allocate());
+      CHECK_NO_THROW(p3 = pool.allocate());
+      CHECK_NO_THROW(p4 = pool.allocate());
+
+      CHECK(p1 != p2);
+      CHECK(p1 != p3);
+      CHECK(p1 != p4);
+      CHECK(p2 != p3);
+      CHECK(p2 != p4);
+      CHECK(p3 != p4);
+
+      CHECK(pool.is_in_pool(p1));
+      CHECK(pool.is_in_pool(p4));
+
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_release)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+      Test_Data* p3 = pool.allocate();
+      Test_Data* p4 = pool.allocate();
+
+      CHECK_NO_THROW(pool.release(p2));
+      CHECK_NO_THROW(pool.release(p3));
+      CHECK_NO_THROW(pool.release(p1));
+      CHECK_NO_THROW(pool.release(p4));
+
+      CHECK_EQUAL(4U, pool.available());
+
+      CHECK_THROW(pool.release(p4), etl::pool_no_allocation);
+      CHECK_EQUAL(4U, pool.available());
+
+      Test_Data not_in_pool;
+
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_size_available_empty_full)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      CHECK_EQUAL(4U, pool.max_size());
+      CHECK_EQUAL(4U, pool.capacity());
+      CHECK(pool.max_item_size() >= sizeof(Test_Data));
+      CHECK(pool.empty());
+      CHECK(!pool.full());
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+
+      CHECK_EQUAL(2U, pool.size());
+      CHECK_EQUAL(2U, pool.available());
+
+      pool.allocate();
+      pool.allocate();
+
+      CHECK(pool.full());
+
+      pool.release(p1);
+      pool.release(p2);
+
+      CHECK_EQUAL(2U, pool.size());
+
+      // The most recently released item is allocated first.
+      CHECK(pool.allocate() == p2);
+      CHECK(pool.allocate() == p1);
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::pool_atomic<D2, 4> pool;
+
+      D2* p = pool.create("1", "2");
+
+      CHECK_EQUAL(1U, pool.size());
+      CHECK_EQUAL(std::string("1"), p->a);
+      CHECK_EQUAL(std::string("2"), p->b);
+
+      pool.destroy(p);
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_generic_allocate)
+    {
+      etl::generic_pool_atomic<sizeof(double), etl::alignment_of<double>::value, 4> pool;
+      etl::ipool_atomic&                                                             ipool = pool;
+
+      uint8_t*  p1 = pool.allocate<uint8_t>();
+      uint32_t* p2 = pool.allocate<uint32_t>();
+      double*   p3 = ipool.allocate<double>();
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK_EQUAL(3U, ipool.size());
+
+      CHECK_THROW(ipool.allocate<Test_Data>(), etl::pool_element_size);
+    }
+
+    //*************************************************************************
+    TEST(test_cache)
+    {
+      etl::pool_atomic<int, 8>  pool;
+      etl::pool_atomic_cache<4> cache(pool);
+
+      // The first allocation takes half of the cache's capacity from the pool.
+      int* p1 = cache.allocate<int>();
+      CHECK_EQUAL(2U, pool.size());
+      CHECK_EQUAL(1U, cache.size());
+
+      int* p2 = cache.allocate<int>();
+      CHECK_EQUAL(2U, pool.size());
+      CHECK_EQUAL(0U, cache.size());
+
+      int* p3 = cache.allocate<int>();
+      CHECK_EQUAL(4U, pool.size());
+      CHECK(p1 != p2);
+      CHECK(p1 != p3);
+      CHECK(p2 != p3);
+
+      // Releases go to the cache.
+      cache.release(p1);
+      cache.release(p2);
+      cache.release(p3);
+      CHECK_EQUAL(4U, cache.size());
+      CHECK_EQUAL(4U, pool.size());
+
+      // The most recently released item is allocated first.
+      CHECK(cache.allocate<int>() == p3);
+      cache.release(p3);
+
+      // A full cache returns half of its items to the pool.
+      int* p4 = pool.allocate();
+      cache.release(p4);
+      CHECK_EQUAL(3U, cache.size());
+      CHECK_EQUAL(3U, pool.size());
+      CHECK(cache.allocate<int>() == p4);
+      cache.release(p4);
+
+      cache.flush();
+      CHECK_EQUAL(0U, cache.size());
+      CHECK(pool.empty());
+
+      // Every item can still be allocated.
+      std::vector<int*> items;
+
+      for (size_t i = 0U; i < pool.max_size(); ++i)
+      {
+        items.push_back(pool.allocate());
+      }
+
+      std::sort(items.begin(), items.end());
+      CHECK(std::unique(items.begin(), items.end()) == items.end());
+      CHECK_THROW(cache.allocate<int>(), etl::pool_no_allocation);
+
+      int not_in_pool;
+      CHECK_THROW(cache.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_cache_destructor_returns_items)
+    {
+      etl::pool_atomic<D2, 8> pool;
+
+      {
+        etl::pool_atomic_cache<4> cache(pool);
+
+        D2* p = cache.create<D2>("1", "2");
+        CHECK_EQUAL(std::string("1"), p->a);
+        cache.destroy(p);
+      }
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static const size_t N_Threads  = 4U;
+      static const int    Iterations = 20000;
+
+      // Enough for each thread's cache and the two items it holds.
+      etl::pool_atomic<int, N_Threads * 6U> pool;
+
+      std::vector<std::thread> threads;
+      std::vector<int>         errors(N_Threads, 0);
+
+      for (size_t t = 0U; t < N_Threads; ++t)
+      {
+        threads.push_back(std::thread([&pool, &errors, t]()
+                                      {
+                                        etl::pool_atomic_cache<4> cache(pool);
+
+                                        for (int i = 0; i < Iterations; ++i)
+                                        {
+                                          int* p1 = (i % 2) == 0 ? pool.create(int(t)) : cache.create<int>(int(t));
+                                          int* p2 = cache.create<int>(int(t));
+
+                                          std::this_thread::yield();
+
+                                          if ((*p1 != int(t)) || (*p2 != int(t)))
+                                          {
+                                            ++errors[t];
+                                          }
+
+                                          cache.release(p1);
+                                          pool.release(p2);
+                                        }
+                                      }));
+      }
+
+      for (size_t t = 0U; t < N_Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      for (size_t t = 0U; t < N_Threads; ++t)
+      {
+        CHECK_EQUAL(0, errors[t]);
+      }
+
+      CHECK(pool.empty());
+    }
+  }
+} // namespace
+
+#endif
@@ -0,0 +1,423 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "etl/queue_mpmc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+  #define REALTIME_TEST 0
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_)
+      , b(b_)
+      , c(c_)
+      , d(d_)
+    {
+    }
+
+    Data()
+      : a(0)
+      , b(0)
+      , c(0)
+      , d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  using ItemM = TestDataM<int>;
+
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(4U, queue.available());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+
+      // Queue full.
+      CHECK(!queue.push(6));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(6));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+  #if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_push_pop)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4> queue;
+
+      ItemM p1(1);
+      ItemM p2(2);
+      ItemM p3(3);
+      ItemM p4(4);
+
+      queue.push(std::move(p1));
+      queue.push(std::move(p2));
+      queue.push(std::move(p3));
+      queue.push(std::move(p4));
+
+      CHECK(!bool(p1));
+      CHECK(!bool(p2));
+      CHECK(!bool(p3));
+      CHECK(!bool(p4));
+
+      ItemM pr(0);
+
+      queue.pop(pr);
+      CHECK_EQUAL(1, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(2, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(3, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(4, pr.value);
+    }
+  #endif
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_mpmc_atomic<Data, 8> queue;
+
+      queue.emplace();
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(5U, queue.size());
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(0, 0, 0, 0));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK(iqueue.push(1));
+      CHECK(iqueue.push(2));
+      CHECK(iqueue.push(3));
+      CHECK(iqueue.push(4));
+      CHECK(!iqueue.push(5));
+      CHECK(iqueue.full());
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK(!iqueue.pop(i));
+      CHECK(iqueue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_position_wrap_around_small)
+    {
+      // The positions of a small memory model queue wrap after 256 pushes.
+      etl::queue_mpmc_atomic<int, 128, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+      int value;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        while (queue.push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK(queue.full());
+        CHECK_EQUAL(128U, queue.size());
+
+        for (int j = 0; j < ((i % 100) + 1); ++j)
+        {
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+      }
+
+      while (queue.pop(value))
+      {
+        CHECK_EQUAL(next_pop, value);
+        ++next_pop;
+      }
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(next_push, next_pop);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4> queue;
+
+      queue.push(ItemM(1));
+      queue.push(ItemM(2));
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(ItemM(1));
+      queue.push(ItemM(2));
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+
+      queue.clear();
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+    }
+
+  #if REALTIME_TEST
+    //*************************************************************************
+    TEST(queue_threads)
+    {
+      static const int    N_Producers = 4;
+      static const size_t N_Consumers = 2;
+      static const int Length      = 100000;
+
+      etl::queue_mpmc_atomic<int, 64> queue;
+
+      std::atomic<int>              popped_count(0);
+      std::vector<std::vector<int>> popped(N_Consumers);
+      std::vector<std::thread>      threads;
+
+      for (int p = 0; p < N_Producers; ++p)
+      {
+        threads.push_back(std::thread([&queue, p]()
+                                      {
+                                        for (int i = 0; i < Length; ++i)
+                                        {
+                                          while (!queue.push((p * Length) + i))
+                                          {
+                                            std::this_thread::yield();
+                                          }
+                                        }
+                                      }));
+      }
+
+      for (size_t c = 0; c < N_Consumers; ++c)
+      {
+        threads.push_back(std::thread([&queue, &popped, &popped_count, c]()
+                                      {
+                                        int value;
+
+                                        while (popped_count.load() < (N_Producers * Length))
+                                        {
+                                          if (queue.pop(value))
+                                          {
+                                            popped[c].push_back(value);
+                                            ++popped_count;
+                                          }
+                                          else
+                                          {
+                                            std::this_thread::yield();
+                                          }
+                                        }
+                                      }));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      // Every value is received exactly once, and each consumer sees each producer's values in order.
+      std::vector<int> all;
+
+      for (size_t c = 0; c < N_Consumers; ++c)
+      {
+        std::vector<int> last(N_Producers, -1);
+
+        for (size_t i = 0; i < popped[c].size(); ++i)
+        {
+          int value    = popped[c][i];
+          size_t producer = size_t(value / Length);
+
+          CHECK(value > last[producer]);
+          last[producer] = value;
+        }
+
+        all.insert(all.end(), popped[c].begin(), popped[c].end());
+      }
+
+      std::sort(all.begin(), all.end());
+
+      CHECK_EQUAL(size_t(N_Producers * Length), all.size());
+
+      for (size_t i = 0; i < all.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), all[i]);
+      }
+    }
+  #endif
+  }
+} // namespace
+
+#endif
@@ -77,6 +77,26 @@ namespace
 
   using ItemM = TestDataM<int>;
 
+  //***************************************************************************
+  // A clock that advances by one tick each time it is read.
+  //***************************************************************************
+  struct ManualClock
+  {
+    using duration   = etl::chrono::milliseconds;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = etl::chrono::time_point<ManualClock, duration>;
+
+    static time_point now()
+    {
+      return time_point(duration(++ticks));
+    }
+
+    static rep ticks;
+  };
+
+  ManualClock::rep ManualClock::ticks = 0;
+
   SUITE(test_queue_atomic)
   {
     //*************************************************************************
@@ -394,6 +414,245 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_wrap_around)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int value = 0;
+      int next_push = 0;
+      int next_pop  = 0;
+
+      // Repeatedly fill and drain the queue by different amounts so that the
+      // cached indexes have to be refreshed at every position in the buffer.
+      for (int i = 0; i < 20; ++i)
+      {
+        while (queue.push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK(queue.full());
+
+        int count = (i % 4) + 1;
+
+        for (int j = 0; j < count; ++j)
+        {
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+
+        CHECK(!queue.full());
+      }
+
+      while (queue.pop(value))
+      {
+        CHECK_EQUAL(next_pop, value);
+        ++next_pop;
+      }
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(next_push, next_pop);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_span)
+    {
+      etl::queue_spsc_atomic<int, 6> queue;
+
+      int input[]  = { 1, 2, 3, 4, 5, 6, 7, 8 };
+      int output[] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(4U, queue.push(etl::span<const int>(input, 4)));
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(3U, queue.pop(etl::span<int>(output, 3)));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+      CHECK_EQUAL(1U, queue.size());
+
+      // Wraps around the end of the buffer and only pushes what fits.
+      CHECK_EQUAL(5U, queue.push(etl::span<const int>(input + 3, 5)));
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.push(etl::span<const int>(input, 1)));
+
+      CHECK_EQUAL(6U, queue.pop(etl::span<int>(output, 8)));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(4, output[1]);
+      CHECK_EQUAL(5, output[2]);
+      CHECK_EQUAL(6, output[3]);
+      CHECK_EQUAL(7, output[4]);
+      CHECK_EQUAL(8, output[5]);
+      CHECK(queue.empty());
+
+      CHECK_EQUAL(0U, queue.pop(etl::span<int>(output, 8)));
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_span_non_trivial)
+    {
+      etl::queue_spsc_atomic<Data, 4> queue;
+
+      Data input[] = { Data(1), Data(2), Data(3) };
+      Data output[3];
+
+      CHECK_EQUAL(3U, queue.push(etl::span<const Data>(input, 3)));
+      CHECK_EQUAL(3U, queue.pop(etl::span<Data>(output, 3)));
+
+      CHECK(output[0] == Data(1));
+      CHECK(output[1] == Data(2));
+      CHECK(output[2] == Data(3));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read_acquire_release)
+    {
+      typedef etl::queue_spsc_atomic<int, 6> Queue;
+
+      Queue queue;
+
+      // Move the indexes to the middle of the buffer.
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+      queue.pop();
+
+      Queue::region_type write_region = queue.write_reserve();
+      CHECK_EQUAL(6U, write_region.size());
+      CHECK_EQUAL(4U, write_region.first.size());
+      CHECK_EQUAL(2U, write_region.second.size());
+
+      int value = 1;
+
+      for (size_t i = 0U; i < write_region.first.size(); ++i)
+      {
+        write_region.first[i] = value++;
+      }
+
+      write_region.second[0] = value++;
+
+      // Nothing is visible until committed.
+      CHECK(queue.empty());
+
+      queue.write_commit(5U);
+      CHECK_EQUAL(5U, queue.size());
+
+      write_region = queue.write_reserve();
+      CHECK_EQUAL(1U, write_region.size());
+      CHECK_EQUAL(1U, write_region.first.size());
+      CHECK_EQUAL(0U, write_region.second.size());
+
+      Queue::region_type read_region = queue.read_acquire(3U);
+      CHECK_EQUAL(3U, read_region.size());
+      CHECK_EQUAL(1, read_region.first[0]);
+      CHECK_EQUAL(2, read_region.first[1]);
+      CHECK_EQUAL(3, read_region.first[2]);
+
+      read_region = queue.read_acquire();
+      CHECK_EQUAL(5U, read_region.size());
+      CHECK_EQUAL(4U, read_region.first.size());
+      CHECK_EQUAL(1U, read_region.second.size());
+      CHECK_EQUAL(4, read_region.first[3]);
+      CHECK_EQUAL(5, read_region.second[0]);
+
+      queue.read_release(5U);
+      CHECK(queue.empty());
+      CHECK(queue.read_acquire().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_commit_release_too_many)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      queue.push(1);
+
+      CHECK_THROW(queue.write_commit(4U), etl::queue_spsc_atomic_commit_invalid);
+      CHECK_THROW(queue.read_release(2U), etl::queue_spsc_atomic_commit_invalid);
+
+      CHECK_EQUAL(1U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_wait_pop_wait_ready)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        queue.push_wait(i);
+      }
+
+      CHECK(queue.full());
+
+      int value = 0;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        queue.pop_wait(value);
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_wait_until_pop_wait_until_timeout)
+    {
+      etl::queue_spsc_atomic<int, 2> queue;
+
+      int value = 0;
+
+      CHECK(!queue.pop_wait_until(value, ManualClock::now() + etl::chrono::milliseconds(10)));
+
+      CHECK(queue.push_wait_until(1, ManualClock::now() + etl::chrono::milliseconds(10)));
+      CHECK(queue.push_wait_until(2, ManualClock::now() + etl::chrono::milliseconds(10)));
+      CHECK(!queue.push_wait_until(3, ManualClock::now() + etl::chrono::milliseconds(10)));
+
+      CHECK(queue.pop_wait_until(value, ManualClock::now() + etl::chrono::milliseconds(10)));
+      CHECK_EQUAL(1, value);
+      CHECK(queue.pop_wait_until(value, ManualClock::now() + etl::chrono::milliseconds(10)));
+      CHECK_EQUAL(2, value);
+      CHECK(!queue.pop_wait_until(value, ManualClock::now() + etl::chrono::milliseconds(10)));
+    }
+
+    //*************************************************************************
+  #if REALTIME_TEST
+    TEST(test_push_wait_pop_wait_threads)
+    {
+      static const int Length = 10000;
+
+      etl::queue_spsc_atomic<int, 8> queue;
+
+      std::thread producer([&queue]()
+                           {
+                             for (int i = 0; i < Length; ++i)
+                             {
+                               queue.push_wait(i);
+                             }
+                           });
+
+      bool in_order = true;
+
+      for (int i = 0; i < Length; ++i)
+      {
+        int value = -1;
+        queue.pop_wait(value);
+        in_order = in_order && (value == i);
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+  #endif
+
     //*************************************************************************
   #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently
@@ -289,6 +289,40 @@ namespace
       CHECK_EQUAL(254U, queue.size());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_span_254)
+    {
+      QueueInt254 queue;
+
+      int input[254];
+      int output[254];
+
+      for (int i = 0; i < 254; ++i)
+      {
+        input[i] = i;
+      }
+
+      // Move the indexes near to the end of the buffer.
+      CHECK_EQUAL(200U, queue.push(etl::span<const int>(input, 200)));
+      CHECK_EQUAL(200U, queue.pop(etl::span<int>(output, 200)));
+
+      CHECK_EQUAL(254U, queue.push(etl::span<const int>(input, 254)));
+      CHECK(queue.full());
+
+      IQueueInt::region_type region = queue.read_acquire();
+      CHECK_EQUAL(254U, region.size());
+      CHECK_EQUAL(55U, region.first.size());
+      CHECK_EQUAL(199U, region.second.size());
+
+      CHECK_EQUAL(254U, queue.pop(etl::span<int>(output, 254)));
+      CHECK(queue.empty());
+
+      for (int i = 0; i < 254; ++i)
+      {
+        CHECK_EQUAL(i, output[i]);
+      }
+    }
+
     //*************************************************************************
     TEST(test_size_push_front_pop)
     {
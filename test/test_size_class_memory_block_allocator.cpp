@@ -0,0 +1,200 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/size_class_memory_block_allocator.h"
+
+#include <type_traits>
+
+namespace
+{
+  using Allocator = etl::size_class_memory_block_allocator<alignof(uint32_t),
+                                                           etl::memory_block_size_class<16, 2>,
+                                                           etl::memory_block_size_class<64, 2>,
+                                                           etl::memory_block_size_class<256, 1>>;
+
+  using Pow2Allocator = etl::power_of_two_memory_block_allocator<16, 128, 3, alignof(uint32_t)>;
+
+  SUITE(test_size_class_memory_block_allocator)
+  {
+    //*************************************************************************
+    TEST(test_size_classes)
+    {
+      Allocator allocator;
+
+      CHECK_EQUAL(3U, Allocator::Number_Of_Size_Classes);
+      CHECK_EQUAL(3U, allocator.number_of_size_classes());
+
+      CHECK_EQUAL(16U, allocator.block_size(0));
+      CHECK_EQUAL(64U, allocator.block_size(1));
+      CHECK_EQUAL(256U, allocator.block_size(2));
+
+      CHECK_EQUAL(2U, allocator.max_size(0));
+      CHECK_EQUAL(2U, allocator.max_size(1));
+      CHECK_EQUAL(1U, allocator.max_size(2));
+
+      CHECK_EQUAL(0U, allocator.find_size_class(1));
+      CHECK_EQUAL(0U, allocator.find_size_class(16));
+      CHECK_EQUAL(1U, allocator.find_size_class(17));
+      CHECK_EQUAL(2U, allocator.find_size_class(256));
+      CHECK_EQUAL(3U, allocator.find_size_class(257));
+    }
+
+    //*************************************************************************
+    TEST(test_power_of_two_size_classes)
+    {
+      using Expected = etl::size_class_memory_block_allocator<alignof(uint32_t),
+                                                              etl::memory_block_size_class<16, 3>,
+                                                              etl::memory_block_size_class<32, 3>,
+                                                              etl::memory_block_size_class<64, 3>,
+                                                              etl::memory_block_size_class<128, 3>>;
+
+      CHECK((std::is_same<Expected, Pow2Allocator>::value));
+
+      Pow2Allocator allocator;
+
+      CHECK_EQUAL(4U, allocator.number_of_size_classes());
+      CHECK_EQUAL(128U, allocator.block_size(3));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_best_fit)
+    {
+      Allocator allocator;
+
+      void* p1 = allocator.allocate(10, alignof(uint32_t));
+      void* p2 = allocator.allocate(40, alignof(uint32_t));
+      void* p3 = allocator.allocate(200, alignof(uint32_t));
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+
+      CHECK_EQUAL(1U, allocator.size(0));
+      CHECK_EQUAL(1U, allocator.size(1));
+      CHECK_EQUAL(1U, allocator.size(2));
+
+      CHECK(allocator.is_owner_of(p1));
+      CHECK(allocator.is_owner_of(p2));
+      CHECK(allocator.is_owner_of(p3));
+
+      CHECK(allocator.release(p1));
+      CHECK(allocator.release(p2));
+      CHECK(allocator.release(p3));
+
+      CHECK(!allocator.is_owner_of(&allocator));
+      CHECK(!allocator.release(&allocator));
+
+      CHECK_EQUAL(0U, allocator.size(0));
+      CHECK_EQUAL(0U, allocator.size(1));
+      CHECK_EQUAL(0U, allocator.size(2));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_too_large_or_too_aligned)
+    {
+      Allocator allocator;
+
+      CHECK(allocator.allocate(257, alignof(uint32_t)) == nullptr);
+      CHECK(allocator.allocate(8, 2 * alignof(uint32_t) * 8) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_to_larger_class)
+    {
+      Allocator allocator;
+
+      void* p1 = allocator.allocate(8, alignof(uint32_t));
+      void* p2 = allocator.allocate(8, alignof(uint32_t));
+      void* p3 = allocator.allocate(8, alignof(uint32_t)); // From the 64 byte class
+      void* p4 = allocator.allocate(8, alignof(uint32_t)); // From the 64 byte class
+      void* p5 = allocator.allocate(8, alignof(uint32_t)); // From the 256 byte class
+      void* p6 = allocator.allocate(8, alignof(uint32_t)); // Nothing left
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK(p4 != nullptr);
+      CHECK(p5 != nullptr);
+      CHECK(p6 == nullptr);
+
+      CHECK_EQUAL(2U, allocator.size(0));
+      CHECK_EQUAL(2U, allocator.size(1));
+      CHECK_EQUAL(1U, allocator.size(2));
+
+      CHECK_EQUAL(4U, allocator.overflow_count(0));
+      CHECK_EQUAL(0U, allocator.overflow_count(1));
+      CHECK_EQUAL(0U, allocator.overflow_count(2));
+    }
+
+    //*************************************************************************
+    TEST(test_high_water_marks)
+    {
+      Allocator allocator;
+
+      void* p1 = allocator.allocate(16, alignof(uint32_t));
+      void* p2 = allocator.allocate(16, alignof(uint32_t));
+      void* p3 = allocator.allocate(64, alignof(uint32_t));
+
+      CHECK_EQUAL(2U, allocator.high_water_mark(0));
+      CHECK_EQUAL(1U, allocator.high_water_mark(1));
+      CHECK_EQUAL(0U, allocator.high_water_mark(2));
+
+      allocator.release(p1);
+      allocator.release(p3);
+
+      CHECK_EQUAL(2U, allocator.high_water_mark(0));
+      CHECK_EQUAL(1U, allocator.high_water_mark(1));
+
+      allocator.reset_statistics();
+
+      CHECK_EQUAL(1U, allocator.high_water_mark(0));
+      CHECK_EQUAL(0U, allocator.high_water_mark(1));
+
+      allocator.release(p2);
+    }
+
+    //*************************************************************************
+    TEST(test_successor)
+    {
+      Allocator                                                        allocator;
+      etl::fixed_sized_memory_block_allocator<1024, alignof(uint32_t), 1> large;
+
+      allocator.set_successor(large);
+
+      void* p1 = allocator.allocate(1000, alignof(uint32_t));
+
+      CHECK(p1 != nullptr);
+      CHECK(large.is_owner_of(p1));
+      CHECK(allocator.is_owner_of(p1));
+      CHECK(allocator.release(p1));
+    }
+  }
+} // namespace
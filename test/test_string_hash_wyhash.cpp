@@ -0,0 +1,133 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Built in the etl_string_hash_wyhash_tests executable, as this changes the hash used for strings.
+#if !defined(ETL_STRING_HASH_USE_WYHASH)
+  #define ETL_STRING_HASH_USE_WYHASH
+#endif
+
+#include "unit_test_framework.h"
+
+#include "etl/fnv_1.h"
+#include "etl/hash.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/u16string.h"
+#include "etl/wyhash.h"
+
+namespace
+{
+  //*************************************************************************
+  // The wyhash of the bytes, folded to the size of size_t.
+  template <typename TChar>
+  size_t expected_hash(const TChar* text, size_t length)
+  {
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(text);
+    const uint8_t* end   = begin + (length * sizeof(TChar));
+
+    uint64_t h = etl::wyhash(begin, end).value();
+
+    if (sizeof(size_t) < sizeof(uint64_t))
+    {
+      h ^= (h >> 32U);
+
+      if (sizeof(size_t) < sizeof(uint32_t))
+      {
+        h ^= (h >> 16U);
+      }
+    }
+
+    return static_cast<size_t>(h);
+  }
+
+  SUITE(test_string_hash_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_string)
+    {
+      const char* text = "The quick brown fox jumps over the lazy dog";
+
+      etl::string<50> s(text);
+
+      size_t hash = etl::hash<etl::string<50> >()(s);
+
+      CHECK_EQUAL(expected_hash(text, s.size()), hash);
+      CHECK_EQUAL(hash, etl::hash<etl::istring>()(s));
+    }
+
+    //*************************************************************************
+    TEST(test_string_view)
+    {
+      const char* text = "The quick brown fox jumps over the lazy dog";
+
+      etl::string_view view(text);
+
+      size_t hash = etl::hash<etl::string_view>()(view);
+
+      CHECK_EQUAL(expected_hash(text, view.size()), hash);
+      CHECK_EQUAL(etl::hash<etl::string<50> >()(etl::string<50>(text)), hash);
+    }
+
+    //*************************************************************************
+    TEST(test_u16string)
+    {
+      const char16_t* text = u"The quick brown fox jumps over the lazy dog";
+
+      etl::u16string<50> s(text);
+
+      CHECK_EQUAL(expected_hash(text, s.size()), etl::hash<etl::u16string<50> >()(s));
+      CHECK_EQUAL(expected_hash(text, s.size()), etl::hash<etl::u16string_view>()(etl::u16string_view(s.data(), s.size())));
+    }
+
+    //*************************************************************************
+    TEST(test_empty_string)
+    {
+      etl::string<10> s;
+
+      CHECK_EQUAL(expected_hash("", 0U), etl::hash<etl::string<10> >()(s));
+      CHECK_EQUAL(expected_hash("", 0U), etl::hash<etl::string_view>()(etl::string_view()));
+    }
+
+    //*************************************************************************
+    TEST(test_not_the_default_hash)
+    {
+      const char* text = "The quick brown fox jumps over the lazy dog";
+
+      etl::string_view view(text);
+
+      const uint8_t* begin = reinterpret_cast<const uint8_t*>(view.data());
+      const uint8_t* end   = begin + view.size();
+
+      size_t fnv_hash = (sizeof(size_t) == sizeof(uint64_t)) ? static_cast<size_t>(etl::fnv_1a_64(begin, end).value())
+                                                             : static_cast<size_t>(etl::fnv_1a_32(begin, end).value());
+
+      CHECK(fnv_hash != etl::hash<etl::string_view>()(view));
+    }
+  }
+}
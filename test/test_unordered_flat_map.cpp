@@ -0,0 +1,414 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/unordered_flat_map.h"
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+  const size_t SIZE = 10;
+
+  typedef etl::unordered_flat_map<int, std::string, SIZE> Data;
+  typedef etl::iunordered_flat_map<int, std::string>      IData;
+
+  //*************************************************************************
+  // A hash that puts every key in the same bucket.
+  struct bad_hash
+  {
+    size_t operator()(int) const
+    {
+      return 0U;
+    }
+  };
+
+  //*************************************************************************
+  template <typename TMap>
+  std::map<int, std::string> to_std_map(const TMap& data)
+  {
+    std::map<int, std::string> result;
+
+    for (typename TMap::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+    {
+      result[itr->first] = itr->second;
+    }
+
+    return result;
+  }
+
+  SUITE(test_unordered_flat_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(16U, data.bucket_count());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find)
+    {
+      Data data;
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Data::value_type(1, "1"));
+      CHECK(result.second);
+      CHECK_EQUAL(1, result.first->first);
+      CHECK_EQUAL(std::string("1"), result.first->second);
+
+      data.insert(Data::value_type(2, "2"));
+      data.insert(Data::value_type(3, "3"));
+
+      // Duplicate.
+      result = data.insert(Data::value_type(2, "two"));
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("2"), result.first->second);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(data.find(1) != data.end());
+      CHECK(data.find(4) == data.end());
+      CHECK_EQUAL(std::string("3"), data.find(3)->second);
+      CHECK(data.contains(2));
+      CHECK(!data.contains(5));
+      CHECK_EQUAL(1U, data.count(2));
+      CHECK_EQUAL(0U, data.count(5));
+
+      const Data& cdata = data;
+      CHECK_EQUAL(std::string("1"), cdata.find(1)->second);
+      CHECK(cdata.find(4) == cdata.end());
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator_and_at)
+    {
+      Data data;
+
+      data[1] = "1";
+      data[2] = "2";
+      data[1] = "one";
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("one"), data.at(1));
+      CHECK_EQUAL(std::string("2"), data[2]);
+      CHECK_THROW(data.at(3), etl::unordered_flat_map_out_of_range);
+
+      const Data& cdata = data;
+      CHECK_EQUAL(std::string("2"), cdata.at(2));
+      CHECK_THROW(cdata.at(3), etl::unordered_flat_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(Data::value_type(i, std::to_string(i)));
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+      CHECK_THROW(data.insert(Data::value_type(100, "100")), etl::unordered_flat_map_full);
+      CHECK_THROW(data[100], etl::unordered_flat_map_full);
+
+      // Existing keys may still be found and updated.
+      CHECK(!data.insert(Data::value_type(0, "0")).second);
+      data[1] = "one";
+      CHECK_EQUAL(std::string("one"), data.at(1));
+    }
+
+    //*************************************************************************
+    TEST(test_iterate)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i * 7] = std::to_string(i);
+      }
+
+      std::map<int, std::string> expected;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        expected[i * 7] = std::to_string(i);
+      }
+
+      CHECK(expected == to_std_map(data));
+      CHECK_EQUAL(SIZE, size_t(std::distance(data.begin(), data.end())));
+      CHECK_EQUAL(SIZE, size_t(std::distance(data.cbegin(), data.cend())));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      Data data;
+
+      data[1] = "1";
+      data[2] = "2";
+      data[3] = "3";
+
+      CHECK_EQUAL(1U, data.erase(2));
+      CHECK_EQUAL(0U, data.erase(2));
+      CHECK_EQUAL(2U, data.size());
+      CHECK(data.find(2) == data.end());
+      CHECK(data.find(1) != data.end());
+      CHECK(data.find(3) != data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_while_iterating)
+    {
+      etl::unordered_flat_map<int, std::string, SIZE, bad_hash> data;
+
+      // All in one run, so every erase shifts the rest back.
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = std::to_string(i);
+      }
+
+      std::vector<int> visited;
+
+      for (etl::unordered_flat_map<int, std::string, SIZE, bad_hash>::iterator itr = data.begin(); itr != data.end();)
+      {
+        visited.push_back(itr->first);
+
+        if ((itr->first % 2) == 0)
+        {
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(SIZE, visited.size());
+      CHECK_EQUAL(SIZE / 2U, data.size());
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK_EQUAL((i % 2) != 0, data.contains(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = std::to_string(i);
+      }
+
+      Data::iterator first = data.begin();
+      Data::iterator last  = data.begin();
+      std::advance(first, 2);
+      std::advance(last, 7);
+
+      std::map<int, std::string> expected = to_std_map(data);
+
+      for (Data::iterator itr = first; itr != last; ++itr)
+      {
+        expected.erase(itr->first);
+      }
+
+      data.erase(first, last);
+
+      CHECK_EQUAL(SIZE - 5U, data.size());
+      CHECK(expected == to_std_map(data));
+
+      data.erase(data.begin(), data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_colliding_hashes)
+    {
+      etl::unordered_flat_map<int, std::string, SIZE, bad_hash> data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK(data.insert(ETL_OR_STD::make_pair(i, std::to_string(i))).second);
+      }
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK_EQUAL(std::to_string(i), data.at(i));
+      }
+
+      data.erase(0);
+      data.erase(5);
+
+      CHECK_EQUAL(SIZE - 2U, data.size());
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK_EQUAL((i != 0) && (i != 5), data.contains(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_probe_limit)
+    {
+      const size_t Probe_Size = 40U;
+
+      typedef etl::unordered_flat_map<int, std::string, Probe_Size, bad_hash> Probe_Data;
+
+      Probe_Data data;
+
+      // Every key has the same home bucket, so only the home bucket and the
+      // probe length after it can be used.
+      const int Reachable = int(Probe_Data::PROBE_LENGTH) + 1;
+
+      for (int i = 0; i < Reachable; ++i)
+      {
+        data[i] = std::to_string(i);
+      }
+
+      CHECK(!data.full());
+      CHECK_THROW(data.insert(Probe_Data::value_type(100, "100")), etl::unordered_flat_map_probe_limit);
+      CHECK_THROW(data[100], etl::unordered_flat_map_probe_limit);
+      CHECK_EQUAL(size_t(Reachable), data.size());
+
+      // Existing keys may still be found.
+      for (int i = 0; i < Reachable; ++i)
+      {
+        CHECK_EQUAL(std::to_string(i), data.at(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_std_map)
+    {
+      const size_t Large_Size = 1000U;
+
+      typedef etl::unordered_flat_map<int, std::string, Large_Size> Large;
+
+      Large*                     p_data = new Large;
+      Large&                     data   = *p_data;
+      std::map<int, std::string> compare;
+
+      std::mt19937                       generator(1234);
+      std::uniform_int_distribution<int> key_distribution(0, 2000);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        int key = key_distribution(generator);
+
+        if ((generator() % 3U) == 0U)
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+        else if (compare.size() < Large_Size)
+        {
+          compare[key] = std::to_string(i);
+          data[key]    = std::to_string(i);
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(compare == to_std_map(data));
+
+      for (std::map<int, std::string>::const_iterator itr = compare.begin(); itr != compare.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->second, data.at(itr->first));
+      }
+
+      delete p_data;
+    }
+
+    //*************************************************************************
+    TEST(test_copy_move_and_assign)
+    {
+      Data data;
+
+      data[1] = "1";
+      data[2] = "2";
+
+      Data copy(data);
+      CHECK(copy == data);
+
+      Data moved(std::move(copy));
+      CHECK(moved == data);
+
+      Data assigned;
+      assigned[3] = "3";
+      assigned    = data;
+      CHECK(assigned == data);
+
+      IData& idata = assigned;
+      idata[4]     = "4";
+      CHECK(assigned != data);
+    }
+
+    //*************************************************************************
+    TEST(test_initializer_list_and_emplace)
+    {
+      Data data{{1, "1"}, {2, "2"}, {3, "3"}};
+
+      CHECK_EQUAL(3U, data.size());
+
+      CHECK(data.emplace(4, "4").second);
+      CHECK(!data.emplace(4, "four").second);
+      CHECK_EQUAL(std::string("4"), data.at(4));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Data data;
+
+      data[1] = "1";
+      data[2] = "2";
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+      CHECK(!data.contains(1));
+
+      data[1] = "1";
+      CHECK_EQUAL(1U, data.size());
+    }
+  }
+} // namespace
@@ -0,0 +1,191 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+#include "random_test_data.h"
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "etl/wyhash.h"
+
+namespace
+{
+  //*************************************************************************
+  // Returns the number of bits that differ.
+  int count_different_bits(uint64_t a, uint64_t b)
+  {
+    uint64_t d     = a ^ b;
+    int      count = 0;
+
+    while (d != 0U)
+    {
+      d &= d - 1U;
+      ++count;
+    }
+
+    return count;
+  }
+
+  SUITE(test_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_reference_values)
+    {
+      // The reference values for wyhash final version 3, with the seed as the index.
+      const std::string data[] = {"", "a", "abc", "message digest", "abcdefghijklmnopqrstuvwxyz",
+                                  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+                                  "12345678901234567890123456789012345678901234567890123456789012345678901234567890"};
+
+      const uint64_t expected[] = {0x42BC986DC5EEC4D3ULL, 0x84508DC903C31551ULL, 0x0BC54887CFC9ECB1ULL, 0x6E2FF3298208A67CULL,
+                                   0x9A64E42E897195B9ULL, 0x9199383239C32554ULL, 0x7C1CCF6BBA30F5A5ULL};
+
+      for (size_t i = 0UL; i < 7UL; ++i)
+      {
+        const uint64_t hash = etl::wyhash(data[i].begin(), data[i].end(), uint64_t(i));
+
+        CHECK_EQUAL(expected[i], hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_add_values)
+    {
+      const std::string data("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789");
+
+      etl::wyhash wyhash(5U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        wyhash.add(uint8_t(data[i]));
+      }
+
+      CHECK_EQUAL(0x9199383239C32554ULL, wyhash.value());
+    }
+
+    //*************************************************************************
+    TEST(test_split_ranges_match_single_range)
+    {
+      // Lengths either side of the 16 and 48 byte boundaries.
+      for (size_t length = 0UL; length <= 200UL; ++length)
+      {
+        const std::vector<uint8_t> data = make_random_data(length);
+
+        const uint64_t expected = etl::wyhash(data.data(), data.data() + data.size());
+
+        for (size_t split = 0UL; split <= length; split += 7UL)
+        {
+          etl::wyhash wyhash;
+          wyhash.add(data.data(), data.data() + split);
+          wyhash.add(data.data() + split, data.data() + length);
+
+          CHECK_EQUAL(expected, wyhash.value());
+        }
+
+        // A non-contiguous range.
+        const std::list<uint8_t> list(data.begin(), data.end());
+
+        CHECK_EQUAL(expected, uint64_t(etl::wyhash(list.begin(), list.end())));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_reset)
+    {
+      const std::vector<uint8_t> data = make_random_data(100UL);
+
+      etl::wyhash wyhash(data.begin(), data.end(), 42U);
+      const uint64_t first = wyhash.value();
+
+      wyhash.reset();
+      wyhash.add(data.begin(), data.end());
+
+      CHECK_EQUAL(first, wyhash.value());
+      CHECK(first != etl::wyhash(data.begin(), data.end(), 43U).value());
+    }
+
+    //*************************************************************************
+    TEST(test_avalanche)
+    {
+      // A 64 byte topic name.
+      std::vector<uint8_t> data(64UL, uint8_t('t'));
+
+      const uint64_t original = etl::wyhash(data.begin(), data.end());
+
+      int total = 0;
+
+      for (size_t bit = 0UL; bit < (data.size() * 8UL); ++bit)
+      {
+        data[bit / 8UL] ^= uint8_t(1U << (bit % 8UL));
+        total += count_different_bits(original, etl::wyhash(data.begin(), data.end()));
+        data[bit / 8UL] ^= uint8_t(1U << (bit % 8UL));
+      }
+
+      // On average, half of the bits should change.
+      const int average = total / int(data.size() * 8UL);
+
+      CHECK(average >= 30);
+      CHECK(average <= 34);
+    }
+
+    //*************************************************************************
+    TEST(test_power_of_two_buckets)
+    {
+      // Similar keys must spread evenly over the low bits.
+      static const size_t Buckets = 64UL;
+      static const size_t Keys    = 64UL * 32UL;
+
+      size_t counts[Buckets] = {};
+
+      for (size_t i = 0UL; i < Keys; ++i)
+      {
+        std::string key("sensors/engine/temperature/");
+        key += std::to_string(i);
+
+        ++counts[etl::wyhash(key.begin(), key.end()).value() % Buckets];
+      }
+
+      for (size_t i = 0UL; i < Buckets; ++i)
+      {
+        CHECK(counts[i] > 10UL);
+        CHECK(counts[i] < 60UL);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_add_after_finalise)
+    {
+      etl::wyhash wyhash;
+      wyhash.add(uint8_t(1U));
+      wyhash.value();
+
+      CHECK_THROW(wyhash.add(uint8_t(2U)), etl::hash_finalised);
+    }
+  }
+} // namespace